@@ -0,0 +1,159 @@
+// adsil_detection_reader: inspects a binary detection export (.adsdet, see
+// utils::DetectionFileFormat) written by DataExporter, converts it back to the CSV the
+// exporter writes in text mode, optionally limited to a frame range.
+//
+// Usage: adsil_detection_reader [--frames FIRST:LAST] [--csv [output.csv]] <file.adsdet>
+//   without --csv a summary is printed; --csv without a path writes to stdout
+
+#include <utils/DetectionFile.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    int usage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " [--frames FIRST:LAST] [--csv [output.csv]] <file"
+                  << utils::DetectionFileFormat::EXTENSION << ">\n"
+                  << "  --frames  keep frames FIRST..LAST (inclusive; either side may be empty)\n"
+                  << "  --csv     convert to CSV, written to output.csv or stdout\n";
+        return 2;
+    }
+
+    // "A:B", "A:" or ":B"; throws std::invalid_argument / std::out_of_range on bad numbers
+    void parseFrameRange(const std::string &text, std::int32_t &first, std::int32_t &last)
+    {
+        const auto colon = text.find(':');
+        if (colon == std::string::npos)
+        {
+            first = last = std::stoi(text);
+            return;
+        }
+        if (colon > 0)
+        {
+            first = std::stoi(text.substr(0, colon));
+        }
+        if (colon + 1 < text.size())
+        {
+            last = std::stoi(text.substr(colon + 1));
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    std::int32_t firstFrame = std::numeric_limits<std::int32_t>::min();
+    std::int32_t lastFrame = std::numeric_limits<std::int32_t>::max();
+    bool csv = false;
+    std::string csvPath;
+    std::string input;
+
+    try
+    {
+        for (std::size_t i = 0; i < args.size(); ++i)
+        {
+            if (args[i] == "--frames" && i + 1 < args.size())
+            {
+                parseFrameRange(args[++i], firstFrame, lastFrame);
+            }
+            else if (args[i] == "--csv")
+            {
+                csv = true;
+                // An optional output path follows unless it is the last (input) argument
+                if (i + 2 < args.size() && args[i + 1].rfind("--", 0) != 0)
+                {
+                    csvPath = args[++i];
+                }
+            }
+            else if (input.empty() && args[i].rfind("--", 0) != 0)
+            {
+                input = args[i];
+            }
+            else
+            {
+                return usage(argv[0]);
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        return usage(argv[0]);
+    }
+    if (input.empty())
+    {
+        return usage(argv[0]);
+    }
+
+    try
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const utils::DetectionFileReader reader(input);
+
+        if (csv)
+        {
+            std::uint64_t rows = 0;
+            if (csvPath.empty())
+            {
+                rows = reader.writeCsv(std::cout, firstFrame, lastFrame);
+            }
+            else
+            {
+                std::ofstream out(csvPath, std::ios::binary | std::ios::trunc);
+                if (!out)
+                {
+                    std::cerr << "Cannot open " << csvPath << " for writing\n";
+                    return 1;
+                }
+                rows = reader.writeCsv(out, firstFrame, lastFrame);
+                const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                std::cerr << rows << " rows -> " << csvPath << " (" << std::fixed << std::setprecision(1) << ms << " ms)\n";
+            }
+            return 0;
+        }
+
+        // Summary: totals plus detections per transmitter within the frame range
+        std::map<std::string, std::uint64_t> perTransmitter;
+        std::uint64_t rows = 0;
+        std::int32_t minFrame = std::numeric_limits<std::int32_t>::max();
+        std::int32_t maxFrame = std::numeric_limits<std::int32_t>::min();
+        reader.forEach([&](const utils::Detection &detection)
+                       {
+                           perTransmitter[std::string(detection.transmitter)]++;
+                           minFrame = std::min(minFrame, detection.frame);
+                           maxFrame = std::max(maxFrame, detection.frame);
+                           ++rows; },
+                       firstFrame, lastFrame);
+
+        std::cout << input << "\n"
+                  << "  records:      " << reader.recordCount() << "\n"
+                  << "  frame runs:   " << reader.frameRuns().size() << "\n"
+                  << "  transmitters: " << reader.transmitters().size() << "\n"
+                  << "  selected:     " << rows;
+        if (rows > 0)
+        {
+            std::cout << " (frames " << minFrame << ".." << maxFrame << ")";
+        }
+        std::cout << "\n";
+        for (const auto &[name, count] : perTransmitter)
+        {
+            std::cout << "    " << std::left << std::setw(24) << name << count << "\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Failed to read " << input << ": " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
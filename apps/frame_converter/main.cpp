@@ -0,0 +1,172 @@
+// adsil_frame_converter: translates a directory of frame_XXXXX.json recordings into the
+// binary ADSF frame format (see simulation::FrameBinaryCodec). FrameBufferManager picks the
+// .adsf files up automatically when they sit next to (or replace) the JSON files.
+// With --pack all frames go into one memory-mapped frames.adspack instead (see
+// simulation::FramePack), which FrameBufferManager prefers over per-frame files.
+//
+// Usage: adsil_frame_converter [--pack] <json_dir> [output_dir]
+
+#include <adapter/implementations/FrameJsonAdapter.hpp>
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <simulation/implementations/FramePack.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double elapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    int usage(const char *program)
+    {
+        std::cerr << "Usage: " << program << " [--pack] <json_dir> [output_dir]\n"
+                  << "Converts every frame_*.json in json_dir to frame_*"
+                  << simulation::FrameBinaryCodec::EXTENSION << " in output_dir (default: json_dir).\n"
+                  << "  --pack  write all frames into one " << simulation::FramePack::DEFAULT_FILE_NAME << " instead\n";
+        return 2;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    const bool packMode = !args.empty() && args.front() == "--pack";
+    if (packMode)
+    {
+        args.erase(args.begin());
+    }
+    if (args.empty() || args.size() > 2)
+    {
+        return usage(argv[0]);
+    }
+
+    const fs::path inputDir = args[0];
+    const fs::path outputDir = args.size() == 2 ? fs::path(args[1]) : inputDir;
+    if (!fs::is_directory(inputDir))
+    {
+        std::cerr << "Not a directory: " << inputDir << "\n";
+        return 1;
+    }
+    fs::create_directories(outputDir);
+
+    std::vector<fs::path> inputs;
+    for (const auto &entry : fs::directory_iterator(inputDir))
+    {
+        const auto name = entry.path().filename().string();
+        if (entry.is_regular_file() && entry.path().extension() == ".json" && name.rfind("frame_", 0) == 0)
+        {
+            inputs.push_back(entry.path());
+        }
+    }
+    std::sort(inputs.begin(), inputs.end());
+
+    const adapter::FrameJsonAdapter frameAdapter;
+    std::uintmax_t jsonBytes = 0;
+    std::uintmax_t binaryBytes = 0;
+    double jsonLoadMs = 0.0;
+    double binaryLoadMs = 0.0;
+    int failures = 0;
+
+    if (packMode)
+    {
+        const fs::path output = outputDir / simulation::FramePack::DEFAULT_FILE_NAME;
+        try
+        {
+            simulation::FramePackWriter writer(output.string());
+            for (const auto &input : inputs)
+            {
+                const auto start = Clock::now();
+                std::ifstream file(input);
+                const auto frame = frameAdapter.fromJson(nlohmann::json::parse(file));
+                jsonLoadMs += elapsedMs(start);
+                jsonBytes += fs::file_size(input);
+                writer.append(*frame);
+            }
+            writer.finish();
+
+            // Read back: validates the pack and measures a full pass over the mapping
+            const auto start = Clock::now();
+            const auto pack = simulation::FramePack::open(output.string());
+            std::size_t points = 0;
+            for (std::size_t i = 0; i < pack->frameCount(); ++i)
+            {
+                points += pack->loadFrame(i)->cloud->size();
+            }
+            binaryLoadMs = elapsedMs(start);
+            if (pack->frameCount() != inputs.size())
+            {
+                throw std::runtime_error("read-back frame count does not match");
+            }
+            binaryBytes = fs::file_size(output);
+            std::cout << inputs.size() << " frames (" << points << " points) -> " << output.string() << "\n";
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Failed to write " << output << ": " << e.what() << "\n";
+            return 1;
+        }
+    }
+    else
+    {
+        for (const auto &input : inputs)
+        {
+            const fs::path output = outputDir / (input.stem().string() + simulation::FrameBinaryCodec::EXTENSION);
+            try
+            {
+                auto start = Clock::now();
+                std::ifstream file(input);
+                const auto frame = frameAdapter.fromJson(nlohmann::json::parse(file));
+                jsonLoadMs += elapsedMs(start);
+
+                simulation::FrameBinaryCodec::writeFile(*frame, output.string());
+
+                // Read back: validates the file and measures the binary load path
+                start = Clock::now();
+                const auto check = simulation::FrameBinaryCodec::readFile(output.string());
+                binaryLoadMs += elapsedMs(start);
+                if (check->cloud->size() != frame->cloud->size() || check->timestamp != frame->timestamp)
+                {
+                    throw std::runtime_error("read-back does not match the source frame");
+                }
+
+                jsonBytes += fs::file_size(input);
+                binaryBytes += fs::file_size(output);
+                std::cout << input.filename().string() << " -> " << output.filename().string() << " ("
+                          << frame->cloud->size() << " points)\n";
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "Failed to convert " << input << ": " << e.what() << "\n";
+                ++failures;
+            }
+        }
+    }
+
+    const auto converted = inputs.size() - static_cast<std::size_t>(failures);
+    std::cout << "\nConverted " << converted << " of " << inputs.size() << " frames\n";
+    if (converted > 0 && binaryBytes > 0 && binaryLoadMs > 0.0)
+    {
+        std::cout << std::fixed << std::setprecision(1)
+                  << "  Size: " << static_cast<double>(jsonBytes) / 1e6 << " MB JSON -> "
+                  << static_cast<double>(binaryBytes) / 1e6 << " MB binary ("
+                  << static_cast<double>(jsonBytes) / static_cast<double>(binaryBytes) << "x smaller)\n"
+                  << "  Load: " << jsonLoadMs << " ms JSON -> " << binaryLoadMs << " ms binary ("
+                  << jsonLoadMs / binaryLoadMs << "x faster)\n";
+    }
+    return failures == 0 ? 0 : 1;
+}
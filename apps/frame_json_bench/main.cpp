@@ -0,0 +1,131 @@
+// adsil_frame_json_bench: times the three ways of loading frame_XXXXX.json recordings
+//
+//   document  AdapterManager::fromJson (utils::loadJsonOrExit + FrameJsonAdapter), the old path
+//   stream    FrameJsonStreamParser, parsing while reading through an ifstream
+//   bulk      FrameJsonStreamParser, one read of the whole file, then parsing from memory
+//
+// Every frame is checked to decode identically on all paths before timings are reported.
+//
+// Usage: adsil_frame_json_bench <json_dir> [repetitions]
+
+#include <adapter/AdapterManager.hpp>
+#include <adapter/implementations/FrameJsonStreamParser.hpp>
+#include <math/PointCloud.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using FramePtr = std::shared_ptr<simulation::Frame>;
+    using Loader = std::function<FramePtr(const std::string &)>;
+
+    bool sameFrame(const simulation::Frame &a, const simulation::Frame &b)
+    {
+        bool same = a.frameId == b.frameId && a.timestamp == b.timestamp && a.cloud->size() == b.cloud->size();
+        for (std::size_t i = 0; same && i < a.cloud->size(); ++i)
+        {
+            const auto &p = a.cloud->getPoints()[i];
+            const auto &q = b.cloud->getPoints()[i];
+            same = p.x() == q.x() && p.y() == q.y() && p.z() == q.z();
+        }
+        return same;
+    }
+
+    // Best of `repetitions` passes over all files, in milliseconds
+    double timeLoader(const Loader &load, const std::vector<std::string> &files, int repetitions)
+    {
+        double best = 0.0;
+        for (int rep = 0; rep < repetitions; ++rep)
+        {
+            const auto start = Clock::now();
+            for (const auto &file : files)
+            {
+                (void)load(file);
+            }
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            best = rep == 0 ? ms : std::min(best, ms);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <json_dir> [repetitions]\n";
+        return 2;
+    }
+
+    const fs::path inputDir = argv[1];
+    const int repetitions = argc == 3 ? std::max(1, std::stoi(argv[2])) : 3;
+
+    std::vector<std::string> files;
+    std::uintmax_t totalBytes = 0;
+    for (const auto &entry : fs::directory_iterator(inputDir))
+    {
+        const auto name = entry.path().filename().string();
+        if (entry.is_regular_file() && entry.path().extension() == ".json" && name.rfind("frame_", 0) == 0)
+        {
+            files.push_back(entry.path().string());
+            totalBytes += entry.file_size();
+        }
+    }
+    std::sort(files.begin(), files.end());
+    if (files.empty())
+    {
+        std::cerr << "No frame_*.json files in " << inputDir << "\n";
+        return 1;
+    }
+
+    adapter::AdapterManager adapters;
+    const std::vector<std::pair<std::string, Loader>> loaders = {
+        {"document", [&](const std::string &path)
+         { return adapters.fromJson<FramePtr>(path); }},
+        {"stream", [](const std::string &path)
+         { return adapter::FrameJsonStreamParser::readFile(path, adapter::FrameJsonStreamParser::ReadMode::Stream); }},
+        {"bulk", [](const std::string &path)
+         { return adapter::FrameJsonStreamParser::readFile(path, adapter::FrameJsonStreamParser::ReadMode::Bulk); }},
+    };
+
+    for (const auto &file : files)
+    {
+        const auto reference = loaders.front().second(file);
+        for (std::size_t i = 1; i < loaders.size(); ++i)
+        {
+            if (!sameFrame(*reference, *loaders[i].second(file)))
+            {
+                std::cerr << loaders[i].first << " path decodes " << file << " differently\n";
+                return 1;
+            }
+        }
+    }
+
+    std::cout << files.size() << " frames, " << std::fixed << std::setprecision(1)
+              << static_cast<double>(totalBytes) / 1e6 << " MB, best of " << repetitions << "\n";
+    double baselineMs = 0.0;
+    for (const auto &[name, load] : loaders)
+    {
+        const double ms = timeLoader(load, files, repetitions);
+        if (baselineMs == 0.0)
+        {
+            baselineMs = ms;
+        }
+        std::cout << "  " << std::left << std::setw(9) << name << std::right << std::setw(9) << ms << " ms  "
+                  << std::setw(7) << static_cast<double>(totalBytes) / 1e6 / (ms / 1e3) << " MB/s  "
+                  << std::setprecision(2) << baselineMs / ms << "x" << std::setprecision(1) << "\n";
+    }
+    return 0;
+}
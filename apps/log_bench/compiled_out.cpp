@@ -0,0 +1,17 @@
+// Built as if configured with -DADSIL_LOG_MIN_LEVEL=NONE, so every statement below is compiled out.
+// Only the macros read ADSIL_LOG_MIN_LEVEL; the Logger class is the same in every translation unit.
+#undef ADSIL_LOG_MIN_LEVEL
+#define ADSIL_LOG_MIN_LEVEL 5
+
+#include <core/Logger.hpp>
+
+#include <cstdint>
+#include <string>
+
+void logCompiledOut(std::uint64_t calls)
+{
+    for (std::uint64_t i = 0; i < calls; ++i)
+    {
+        LOGGER_DEBUG("bench", "value " + std::to_string(i));
+    }
+}
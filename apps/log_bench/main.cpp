@@ -0,0 +1,85 @@
+// adsil_log_bench: per-call cost of log statements that are filtered out versus written
+//
+//   compiled out     ADSIL_LOG_MIN_LEVEL above the statement's level
+//   level disabled   compiled in, logger level set above the statement's level
+//   every 1000th     LOGGER_*_EVERY_N(1000, ...) with the level enabled
+//   enabled          written to a log file, synchronously and with the asynchronous writer
+//
+// Each statement builds its message with std::to_string, which disabled statements must skip.
+//
+// Usage: adsil_log_bench [calls]
+
+#include <core/Logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+void logCompiledOut(std::uint64_t calls);
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Body>
+    void measure(const char *name, std::uint64_t calls, Body body)
+    {
+        const auto start = Clock::now();
+        body(calls);
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        std::cout << "  " << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(10) << ns / static_cast<double>(calls) << " ns/call" << std::endl;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    const std::uint64_t writtenCalls = std::max<std::uint64_t>(calls / 100, 1);
+
+    const auto logPath = std::filesystem::temp_directory_path() / "adsil_log_bench.log";
+    auto &logger = core::Logger::getInstance("bench");
+    logger.setLogFile(logPath.string());
+
+    std::cout << "Log statement cost (" << calls << " calls, " << writtenCalls << " when written)" << std::endl;
+
+    measure("compiled out", calls, logCompiledOut);
+
+    logger.setLevel(core::Logger::Level::WARN);
+    core::Logger::getInstance().setLevel(core::Logger::Level::WARN);
+    measure("level disabled", calls, [](std::uint64_t n)
+            {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    LOGGER_DEBUG("bench", "value " + std::to_string(i));
+                } });
+
+    logger.setLevel(core::Logger::Level::TRACE);
+    measure("every 1000th", calls, [](std::uint64_t n)
+            {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    LOGGER_DEBUG_EVERY_N(1000, "bench", "value " + std::to_string(i));
+                } });
+
+    const auto writeAll = [](std::uint64_t n)
+    {
+        for (std::uint64_t i = 0; i < n; ++i)
+        {
+            LOGGER_DEBUG("bench", "value " + std::to_string(i));
+        }
+    };
+    measure("enabled, sync", writtenCalls, writeAll);
+
+    core::Logger::startAsync();
+    measure("enabled, async", writtenCalls, writeAll);
+    core::Logger::stopAsync();
+
+    std::filesystem::remove(logPath);
+    return 0;
+}
@@ -0,0 +1,90 @@
+// adsil_timer_bench: per-measurement cost of core::Timer
+//
+//   clock only       two steady_clock reads, the floor for any scoped timer
+//   TIMER_SCOPE      interned id, per-thread slots
+//   measure(name)    the name overload, which looks the name up on every call
+//   TIMER_SCOPE x4   four threads timing the same name at once
+//
+// Timers are compiled out under NDEBUG, so this file turns them on for Release builds.
+//
+// Usage: adsil_timer_bench [calls]
+
+#undef ADSIL_TIMERS
+#define ADSIL_TIMERS 1
+
+#include <core/Timer.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    template <typename Body>
+    void measure(const char *name, std::uint64_t calls, Body body)
+    {
+        const auto start = Clock::now();
+        body(calls);
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        std::cout << "  " << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(8) << ns / static_cast<double>(calls) << " ns/call" << std::endl;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const std::uint64_t calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5'000'000;
+    std::cout << "Timer cost (" << calls << " calls)" << std::endl;
+
+    measure("clock only", calls, [](std::uint64_t n)
+            {
+                std::int64_t sum = 0;
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    const auto start = Clock::now();
+                    sum += (Clock::now() - start).count();
+                }
+                if (sum < 0)
+                    std::cout << sum << std::endl; });
+
+    measure("TIMER_SCOPE", calls, [](std::uint64_t n)
+            {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    TIMER_SCOPE("bench_scope");
+                } });
+
+    measure("measure(name)", calls, [](std::uint64_t n)
+            {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    core::Timer::measure("bench_named", [] {});
+                } });
+
+    measure("TIMER_SCOPE x4", calls, [](std::uint64_t n)
+            {
+                std::vector<std::thread> threads;
+                for (int t = 0; t < 4; ++t)
+                {
+                    threads.emplace_back([n]
+                                         {
+                                             for (std::uint64_t i = 0; i < n / 4; ++i)
+                                             {
+                                                 TIMER_SCOPE("bench_threads");
+                                             } });
+                }
+                for (auto &thread : threads)
+                {
+                    thread.join();
+                } });
+
+    const auto merged = core::Timer::getTimerStats("bench_threads");
+    std::cout << "  merged count from 4 threads: " << merged.count << std::endl;
+    return 0;
+}
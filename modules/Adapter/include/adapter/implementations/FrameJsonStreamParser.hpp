@@ -0,0 +1,41 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace adapter
+{
+    /**
+     * @class FrameJsonStreamParser
+     * @brief Reads frame_XXXXX.json recordings without building a JSON document
+     *
+     * Parsing is event based (nlohmann SAX interface): numbers inside "pointcloud" are appended
+     * straight to a reserved point buffer, "timestamp", "frame_id" and "imu" go into the Frame,
+     * and every other value is skipped. The result matches FrameJsonAdapter::fromJson bit for bit
+     * (including skipping points that do not have exactly three coordinates).
+     *
+     * In-memory text (parse() and ReadMode::Bulk) is tokenized by a small scanner built on
+     * std::from_chars, which also counts the points up front so the buffer is reserved exactly.
+     * ReadMode::Stream uses nlohmann::json::sax_parse on the ifstream instead.
+     *
+     * Throws std::runtime_error on I/O errors, malformed JSON or a missing "timestamp" /
+     * "pointcloud".
+     */
+    class FrameJsonStreamParser
+    {
+    public:
+        enum class ReadMode
+        {
+            Bulk,  // read the whole file with one read, then scan it in memory
+            Stream // parse while reading through an ifstream; needs no whole-file buffer
+        };
+
+        static std::shared_ptr<simulation::Frame> parse(std::string_view text);
+        // Points are parsed into `storage` (cleared first), so a recycled buffer avoids allocating
+        static std::shared_ptr<simulation::Frame> readFile(const std::string &path, ReadMode mode = ReadMode::Bulk,
+                                                           std::vector<math::Point> storage = {});
+    };
+}
@@ -10,9 +10,11 @@ namespace adapter
     nlohmann::json FrameJsonAdapter::toJson(const std::shared_ptr<simulation::Frame> &frame) const
     {
         nlohmann::json j;
+        if (frame->frameId >= 0)
+            j["frame_id"] = frame->frameId;
         j["timestamp"] = frame->timestamp;
-        // j["imu"]["linear_acceleration"] = frame->linearAcceleration;
-        // j["imu"]["angular_velocity"] = frame->angularVelocity;
+        j["imu"]["linear_acceleration"] = frame->linearAcceleration;
+        j["imu"]["angular_velocity"] = frame->angularVelocity;
 
         j["pointcloud"] = nlohmann::json::array();
         for (const auto &pt : frame->cloud->getPoints())
@@ -35,8 +37,16 @@ namespace adapter
         std::shared_ptr<simulation::Frame> frame = std::make_shared<simulation::Frame>();
         frame->cloud = cloud;
         frame->timestamp = j.at("timestamp").get<double>();
-        // frame->linearAcceleration = j.at("imu").at("linear_acceleration").get<std::vector<float>>();
-        // frame->angularVelocity = j.at("imu").at("angular_velocity").get<std::vector<float>>();
+        if (j.contains("frame_id"))
+            frame->frameId = j.at("frame_id").get<int>();
+        if (j.contains("imu"))
+        {
+            const auto &imu = j.at("imu");
+            if (imu.contains("linear_acceleration"))
+                frame->linearAcceleration = imu.at("linear_acceleration").get<std::array<float, 3>>();
+            if (imu.contains("angular_velocity"))
+                frame->angularVelocity = imu.at("angular_velocity").get<std::array<float, 3>>();
+        }
         return frame;
     }
 };
@@ -0,0 +1,415 @@
+#include <adapter/implementations/FrameJsonStreamParser.hpp>
+#include <math/PointCloud.hpp>
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace adapter
+{
+    namespace
+    {
+        // Pretty-printed frames spend ~80 bytes per point; a lower guess only costs one regrow
+        constexpr std::size_t STREAM_BYTES_PER_POINT = 64;
+
+        using Json = nlohmann::json;
+
+        class FrameSaxHandler : public nlohmann::json_sax<Json>
+        {
+        public:
+            explicit FrameSaxHandler(std::size_t expectedPoints, std::vector<math::Point> storage = {})
+                : points_(std::move(storage))
+            {
+                points_.clear();
+                points_.reserve(expectedPoints);
+            }
+
+            std::shared_ptr<simulation::Frame> finish(const std::string &source)
+            {
+                if (!error_.empty())
+                    throw std::runtime_error("FrameJsonStreamParser: " + source + ": " + error_);
+                if (!hasTimestamp_ || !hasPointCloud_)
+                    throw std::runtime_error("FrameJsonStreamParser: " + source + " lacks \"timestamp\" or \"pointcloud\"");
+
+                frame_->cloud = std::make_shared<math::PointCloud>(std::move(points_));
+                return frame_;
+            }
+
+            bool null() override { return true; }
+            bool boolean(bool) override { return true; }
+            bool string(string_t &) override { return true; }
+            bool binary(binary_t &) override { return true; }
+
+            bool number_integer(number_integer_t value) override { return number(static_cast<double>(value)); }
+            bool number_unsigned(number_unsigned_t value) override { return number(static_cast<double>(value)); }
+            bool number_float(number_float_t value, const string_t &) override { return number(value); }
+
+            bool start_object(std::size_t) override
+            {
+                if (depth_ == 1 && section_ == Section::ImuPending)
+                    section_ = Section::Imu;
+                ++depth_;
+                return true;
+            }
+
+            bool end_object() override
+            {
+                --depth_;
+                if (depth_ == 1)
+                    section_ = Section::None;
+                return true;
+            }
+
+            bool key(string_t &name) override
+            {
+                if (depth_ == 1)
+                {
+                    section_ = Section::None;
+                    if (name == "timestamp")
+                        section_ = Section::Timestamp;
+                    else if (name == "frame_id")
+                        section_ = Section::FrameId;
+                    else if (name == "imu")
+                        section_ = Section::ImuPending;
+                    else if (name == "pointcloud")
+                        section_ = Section::PointCloud;
+                }
+                else if (depth_ == 2 && section_ == Section::Imu)
+                {
+                    imuTarget_ = nullptr;
+                    if (name == "linear_acceleration")
+                        imuTarget_ = &frame_->linearAcceleration;
+                    else if (name == "angular_velocity")
+                        imuTarget_ = &frame_->angularVelocity;
+                }
+                return true;
+            }
+
+            bool start_array(std::size_t) override
+            {
+                ++depth_;
+                if (depth_ == 3)
+                    coordCount_ = 0;
+                if (depth_ == 2 && section_ == Section::PointCloud)
+                    hasPointCloud_ = true;
+                return true;
+            }
+
+            bool end_array() override
+            {
+                // A point is one [x, y, z] array directly inside "pointcloud"
+                if (depth_ == 3 && section_ == Section::PointCloud && coordCount_ == 3)
+                    points_.emplace_back(coords_[0], coords_[1], coords_[2]);
+                --depth_;
+                if (depth_ == 1)
+                    section_ = Section::None;
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string &, const nlohmann::detail::exception &ex) override
+            {
+                error_ = ex.what();
+                return false;
+            }
+
+        private:
+            enum class Section
+            {
+                None,
+                Timestamp,
+                FrameId,
+                ImuPending,
+                Imu,
+                PointCloud
+            };
+
+            bool number(double value)
+            {
+                if (depth_ == 1 && section_ == Section::Timestamp)
+                {
+                    frame_->timestamp = value;
+                    hasTimestamp_ = true;
+                }
+                else if (depth_ == 1 && section_ == Section::FrameId)
+                {
+                    frame_->frameId = static_cast<int>(value);
+                }
+                else if (depth_ == 3 && section_ == Section::Imu && imuTarget_ && coordCount_ < 3)
+                {
+                    (*imuTarget_)[coordCount_++] = static_cast<float>(value);
+                }
+                else if (depth_ == 3 && section_ == Section::PointCloud)
+                {
+                    if (coordCount_ < 3)
+                        coords_[coordCount_] = static_cast<float>(value);
+                    ++coordCount_;
+                }
+                return true;
+            }
+
+            std::shared_ptr<simulation::Frame> frame_ = std::make_shared<simulation::Frame>();
+            std::vector<math::Point> points_;
+            Section section_ = Section::None;
+            std::array<float, 3> *imuTarget_ = nullptr;
+            int depth_ = 0;
+            std::size_t coordCount_ = 0;
+            float coords_[3] = {};
+            bool hasTimestamp_ = false;
+            bool hasPointCloud_ = false;
+            std::string error_;
+        };
+
+        /**
+         * Hand-written JSON scanner for in-memory text. It feeds the same events as
+         * Json::sax_parse, but reads numbers with std::from_chars and skips string values
+         * without copying them, which is where nlohmann's lexer spends most of its time on
+         * point-heavy frames. Escapes in keys are kept verbatim (frame keys have none).
+         */
+        class FrameScanner
+        {
+        public:
+            FrameScanner(std::string_view text, FrameSaxHandler &handler)
+                : pos_(text.data()), begin_(text.data()), end_(text.data() + text.size()), handler_(handler)
+            {
+            }
+
+            void run()
+            {
+                skipWhitespace();
+                value(0);
+                skipWhitespace();
+                if (pos_ != end_)
+                    fail("unexpected trailing characters");
+            }
+
+        private:
+            static constexpr int MAX_DEPTH = 64;
+
+            [[noreturn]] void fail(const std::string &what) const
+            {
+                throw std::runtime_error(what + " at byte " + std::to_string(pos_ - begin_));
+            }
+
+            char peek() const { return pos_ != end_ ? *pos_ : '\0'; }
+
+            void expect(char c)
+            {
+                if (peek() != c)
+                    fail(std::string("expected '") + c + "'");
+                ++pos_;
+            }
+
+            void skipWhitespace()
+            {
+                while (pos_ != end_ && (*pos_ == ' ' || *pos_ == '\n' || *pos_ == '\r' || *pos_ == '\t'))
+                    ++pos_;
+            }
+
+            void value(int depth)
+            {
+                if (depth > MAX_DEPTH)
+                    fail("nesting too deep");
+
+                switch (peek())
+                {
+                case '{':
+                    object(depth);
+                    break;
+                case '[':
+                    array(depth);
+                    break;
+                case '"':
+                    skipString();
+                    handler_.string(key_);
+                    break;
+                case 't':
+                    literal("true");
+                    handler_.boolean(true);
+                    break;
+                case 'f':
+                    literal("false");
+                    handler_.boolean(false);
+                    break;
+                case 'n':
+                    literal("null");
+                    handler_.null();
+                    break;
+                default:
+                    number();
+                    break;
+                }
+            }
+
+            void object(int depth)
+            {
+                ++pos_;
+                handler_.start_object(static_cast<std::size_t>(-1));
+                skipWhitespace();
+                if (peek() == '}')
+                {
+                    ++pos_;
+                    handler_.end_object();
+                    return;
+                }
+                while (true)
+                {
+                    readKey();
+                    handler_.key(key_);
+                    skipWhitespace();
+                    expect(':');
+                    skipWhitespace();
+                    value(depth + 1);
+                    skipWhitespace();
+                    if (peek() != ',')
+                        break;
+                    ++pos_;
+                    skipWhitespace();
+                }
+                expect('}');
+                handler_.end_object();
+            }
+
+            void array(int depth)
+            {
+                ++pos_;
+                handler_.start_array(static_cast<std::size_t>(-1));
+                skipWhitespace();
+                if (peek() == ']')
+                {
+                    ++pos_;
+                    handler_.end_array();
+                    return;
+                }
+                while (true)
+                {
+                    value(depth + 1);
+                    skipWhitespace();
+                    if (peek() != ',')
+                        break;
+                    ++pos_;
+                    skipWhitespace();
+                }
+                expect(']');
+                handler_.end_array();
+            }
+
+            void readKey()
+            {
+                if (peek() != '"')
+                    fail("expected object key");
+                const char *start = ++pos_;
+                skipStringBody();
+                key_.assign(start, static_cast<std::size_t>(pos_ - 1 - start));
+            }
+
+            void skipString()
+            {
+                ++pos_;
+                skipStringBody();
+            }
+
+            // Leaves pos_ just past the closing quote
+            void skipStringBody()
+            {
+                while (pos_ != end_)
+                {
+                    const char c = *pos_++;
+                    if (c == '"')
+                        return;
+                    if (c == '\\' && pos_ != end_)
+                        ++pos_;
+                }
+                fail("unterminated string");
+            }
+
+            void literal(const char *word)
+            {
+                const std::size_t length = std::strlen(word);
+                if (static_cast<std::size_t>(end_ - pos_) < length || std::memcmp(pos_, word, length) != 0)
+                    fail("invalid literal");
+                pos_ += length;
+            }
+
+            void number()
+            {
+                const char c = peek();
+                if (c != '-' && (c < '0' || c > '9'))
+                    fail("unexpected character");
+
+                double parsed = 0.0;
+                const auto [next, ec] = std::from_chars(pos_, end_, parsed);
+                if (ec != std::errc())
+                    fail("invalid number");
+                pos_ = next;
+                handler_.number_float(parsed, EMPTY_);
+            }
+
+            const char *pos_;
+            const char *begin_;
+            const char *end_;
+            FrameSaxHandler &handler_;
+            std::string key_;
+            inline static const std::string EMPTY_;
+        };
+
+        // Every point opens one '[', so this bounds the point count from above
+        std::size_t countPointsUpperBound(std::string_view text)
+        {
+            return static_cast<std::size_t>(std::count(text.begin(), text.end(), '['));
+        }
+
+        std::shared_ptr<simulation::Frame> parseText(std::string_view text, const std::string &source,
+                                                     std::vector<math::Point> storage = {})
+        {
+            FrameSaxHandler handler(countPointsUpperBound(text), std::move(storage));
+            try
+            {
+                FrameScanner(text, handler).run();
+            }
+            catch (const std::runtime_error &e)
+            {
+                throw std::runtime_error("FrameJsonStreamParser: " + source + ": " + e.what());
+            }
+            return handler.finish(source);
+        }
+    } // namespace
+
+    std::shared_ptr<simulation::Frame> FrameJsonStreamParser::parse(std::string_view text)
+    {
+        return parseText(text, "<memory>");
+    }
+
+    std::shared_ptr<simulation::Frame> FrameJsonStreamParser::readFile(const std::string &path, ReadMode mode,
+                                                                       std::vector<math::Point> storage)
+    {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+            throw std::runtime_error("FrameJsonStreamParser: cannot open " + path);
+        const auto size = static_cast<std::size_t>(file.tellg());
+        file.seekg(0);
+
+        std::shared_ptr<simulation::Frame> frame;
+        if (mode == ReadMode::Bulk)
+        {
+            std::string text(size, '\0');
+            file.read(text.data(), static_cast<std::streamsize>(size));
+            if (!file)
+                throw std::runtime_error("FrameJsonStreamParser: failed to read " + path);
+
+            frame = parseText(text, path, std::move(storage));
+        }
+        else
+        {
+            FrameSaxHandler handler(size / STREAM_BYTES_PER_POINT, std::move(storage));
+            Json::sax_parse(file, &handler);
+            frame = handler.finish(path);
+        }
+
+        frame->filePath = path;
+        return frame;
+    }
+}
@@ -0,0 +1,136 @@
+// Unit tests for the SAX frame parser: it must agree with FrameJsonAdapter on every frame.
+
+#include <adapter/implementations/FrameJsonStreamParser.hpp>
+#include <adapter/implementations/FrameJsonAdapter.hpp>
+#include <math/PointCloud.hpp>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace adapter;
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static const char *SAMPLE_FRAME = R"({
+  "frame_id": 7,
+  "timestamp": 1746466084.1829212,
+  "imu": {
+    "linear_acceleration": [0.0023, 0.0011, 0.0981],
+    "angular_velocity": [-0.0, 0.0, -0.5]
+  },
+  "extra": {"nested": [[1, 2, 3]], "note": "ignored"},
+  "pointcloud": [
+    [38.8849983215332, 17.95199966430664, 5.775000095367432],
+    [1, 2],
+    [-3, 4e2, 0.1],
+    [1.0, 2.0, 3.0, 4.0],
+    [31.579999923706055, 15.1850004196167, 7.1539998054504395]
+  ]
+})";
+
+static bool sameFrame(const simulation::Frame &a, const simulation::Frame &b)
+{
+    bool same = a.frameId == b.frameId && a.timestamp == b.timestamp &&
+                a.linearAcceleration == b.linearAcceleration && a.angularVelocity == b.angularVelocity &&
+                a.cloud->size() == b.cloud->size();
+    for (std::size_t i = 0; same && i < a.cloud->size(); ++i)
+    {
+        const auto &p = a.cloud->getPoints()[i];
+        const auto &q = b.cloud->getPoints()[i];
+        same = p.x() == q.x() && p.y() == q.y() && p.z() == q.z();
+    }
+    return same;
+}
+
+static bool parseThrows(const std::string &text)
+{
+    try
+    {
+        (void)FrameJsonStreamParser::parse(text);
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+void testMatchesDomAdapter()
+{
+    std::cout << "\n=== testMatchesDomAdapter ===" << std::endl;
+    const auto expected = FrameJsonAdapter().fromJson(nlohmann::json::parse(SAMPLE_FRAME));
+    const auto parsed = FrameJsonStreamParser::parse(SAMPLE_FRAME);
+
+    SimpleTest::assert_true(parsed->cloud->size() == 3, "Only points with exactly three coordinates are kept");
+    SimpleTest::assert_true(sameFrame(*expected, *parsed), "SAX result matches the DOM adapter bit for bit");
+}
+
+void testReadModes()
+{
+    std::cout << "\n=== testReadModes ===" << std::endl;
+    const auto path = (std::filesystem::temp_directory_path() / "adsil_frame_stream_parser_test.json").string();
+    {
+        std::ofstream file(path);
+        file << SAMPLE_FRAME;
+    }
+
+    const auto bulk = FrameJsonStreamParser::readFile(path, FrameJsonStreamParser::ReadMode::Bulk);
+    const auto stream = FrameJsonStreamParser::readFile(path, FrameJsonStreamParser::ReadMode::Stream);
+    SimpleTest::assert_true(sameFrame(*bulk, *stream), "Bulk and stream reads agree");
+    SimpleTest::assert_true(bulk->filePath == path, "Loaded frame records its file path");
+
+    bool missingThrows = false;
+    try
+    {
+        (void)FrameJsonStreamParser::readFile(path + ".missing");
+    }
+    catch (const std::runtime_error &)
+    {
+        missingThrows = true;
+    }
+    SimpleTest::assert_true(missingThrows, "Missing file is rejected");
+    std::filesystem::remove(path);
+}
+
+void testRejectsMalformedInput()
+{
+    std::cout << "\n=== testRejectsMalformedInput ===" << std::endl;
+    SimpleTest::assert_true(parseThrows(R"({"timestamp": 1.0, "pointcloud": [[1, 2, 3])"), "Truncated JSON is rejected");
+    SimpleTest::assert_true(parseThrows(R"({"pointcloud": []})"), "Missing timestamp is rejected");
+    SimpleTest::assert_true(parseThrows(R"({"timestamp": 1.0})"), "Missing pointcloud is rejected");
+    SimpleTest::assert_true(!parseThrows(R"({"timestamp": 1.0, "pointcloud": []})"), "Empty pointcloud is accepted");
+}
+
+int main()
+{
+    std::cout << "FrameJsonStreamParser Test Suite" << std::endl;
+    std::cout << "================================" << std::endl;
+
+    testMatchesDomAdapter();
+    testReadModes();
+    testRejectsMalformedInput();
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
@@ -0,0 +1,572 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace core
+{
+    // What a logging thread does when its ring is full
+    enum class LogOverflowPolicy
+    {
+        Block, // wait for the writer thread; nothing is lost
+        Drop   // discard the record and count it; the caller never waits
+    };
+
+    struct AsyncLogOptions
+    {
+        // Records per logging thread, rounded up to a power of two; a thread keeps the ring it
+        // got on its first call, so a new capacity applies to threads that start logging later
+        std::size_t ringCapacity = 1024;
+        LogOverflowPolicy overflow = LogOverflowPolicy::Block;
+        // Longest a record waits before it is written and flushed; ERROR records are written at once
+        std::chrono::milliseconds maxLatency{20};
+    };
+
+    struct AsyncLogStats
+    {
+        std::uint64_t enqueued = 0; // records handed to the writer thread
+        std::uint64_t written = 0;  // records written by it
+        std::uint64_t dropped = 0;  // records discarded by LogOverflowPolicy::Drop
+        std::uint64_t blocked = 0;  // calls that had to wait for ring space
+        std::size_t threads = 0;    // logging threads with a ring
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief One queued log call
+         *
+         * Fixed size so it lives in a ring slot. The payload holds either the finished message or
+         * the call's arguments, which render() turns into text on the writer thread. Messages
+         * that do not fit are moved to heapMessage.
+         */
+        struct LogRecord
+        {
+            static constexpr std::size_t PAYLOAD_BYTES = 160;
+
+            using Render = void (*)(std::string &out, const LogRecord &record);
+            using Emit = void (*)(const LogRecord &record, const std::string &message);
+            using Flush = void (*)(void *target);
+
+            void *target = nullptr; // the Logger
+            Emit emit = nullptr;
+            Flush flush = nullptr;
+            Render render = nullptr;
+            const char *format = nullptr; // static format string of a deferred call
+            const char *file = nullptr;
+            const char *func = nullptr;
+            int line = 0;
+            int level = 0;
+            std::uint32_t threadId = 0;
+            std::chrono::system_clock::time_point time;
+            std::unique_ptr<std::string> heapMessage;
+            std::uint32_t payloadSize = 0;
+            alignas(8) unsigned char payload[PAYLOAD_BYTES];
+        };
+
+        // Sequential writes into a record payload; `overflow` is set instead of writing past the end
+        class LogPayloadWriter
+        {
+        public:
+            explicit LogPayloadWriter(LogRecord &record) : record_(record) {}
+
+            void bytes(const void *data, std::size_t size)
+            {
+                if (overflow || size > LogRecord::PAYLOAD_BYTES - record_.payloadSize)
+                {
+                    overflow = true;
+                    return;
+                }
+                std::memcpy(record_.payload + record_.payloadSize, data, size);
+                record_.payloadSize += static_cast<std::uint32_t>(size);
+            }
+
+            void text(std::string_view value)
+            {
+                const auto size = static_cast<std::uint32_t>(value.size());
+                bytes(&size, sizeof(size));
+                bytes(value.data(), value.size());
+            }
+
+            bool overflow = false;
+
+        private:
+            LogRecord &record_;
+        };
+
+        class LogPayloadReader
+        {
+        public:
+            explicit LogPayloadReader(const LogRecord &record) : data_(record.payload) {}
+
+            template <typename T>
+            T value()
+            {
+                T result;
+                std::memcpy(&result, data_ + offset_, sizeof(T));
+                offset_ += sizeof(T);
+                return result;
+            }
+
+            std::string_view text()
+            {
+                const auto size = value<std::uint32_t>();
+                const std::string_view result(reinterpret_cast<const char *>(data_ + offset_), size);
+                offset_ += size;
+                return result;
+            }
+
+        private:
+            const unsigned char *data_;
+            std::size_t offset_ = 0;
+        };
+
+        // How an argument is stored: numbers by value, text by copy, anything else pre-rendered
+        template <typename T>
+        constexpr bool isLogNumber = std::is_arithmetic_v<std::decay_t<T>>;
+
+        template <typename T>
+        void encodeLogArg(LogPayloadWriter &writer, const T &arg)
+        {
+            if constexpr (isLogNumber<T>)
+            {
+                writer.bytes(&arg, sizeof(arg));
+            }
+            else if constexpr (std::is_convertible_v<const T &, std::string_view>)
+            {
+                writer.text(std::string_view(arg));
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << arg;
+                writer.text(oss.str());
+            }
+        }
+
+        // Same text detail::format produces for the argument
+        template <typename T>
+        void appendLogArg(std::string &out, LogPayloadReader &reader)
+        {
+            if constexpr (isLogNumber<T>)
+            {
+                out += std::to_string(reader.value<std::decay_t<T>>());
+            }
+            else
+            {
+                out += reader.text();
+            }
+        }
+
+        // Renders message-only records
+        inline void renderLogMessage(std::string &out, const LogRecord &record)
+        {
+            if (record.heapMessage)
+            {
+                out += *record.heapMessage;
+                return;
+            }
+            LogPayloadReader reader(record);
+            out += reader.text();
+        }
+
+        // Renders deferred calls: "{}" placeholders are replaced in order, like detail::format
+        template <typename... Args>
+        void renderLogFormat(std::string &out, const LogRecord &record)
+        {
+            const std::string_view format(record.format);
+            LogPayloadReader reader(record);
+            std::size_t last = 0;
+            const auto next = [&](auto appendArg)
+            {
+                const auto placeholder = format.find("{}", last);
+                if (placeholder == std::string_view::npos)
+                {
+                    std::string ignored;
+                    appendArg(ignored); // still consume the stored argument
+                    return;
+                }
+                out.append(format.substr(last, placeholder - last));
+                appendArg(out);
+                last = placeholder + 2;
+            };
+            (next([&reader](std::string &target)
+                  { appendLogArg<Args>(target, reader); }),
+             ...);
+            out.append(format.substr(last));
+        }
+
+        /**
+         * @brief Single-producer single-consumer ring of log records, one per logging thread
+         *
+         * The producer fills a slot in place (claim / publish), so a record is never copied.
+         */
+        class LogRing
+        {
+        public:
+            explicit LogRing(std::size_t capacity)
+            {
+                capacity_ = 1;
+                while (capacity_ < std::max<std::size_t>(capacity, 2))
+                {
+                    capacity_ <<= 1;
+                }
+                slots_ = std::make_unique<LogRecord[]>(capacity_);
+            }
+
+            // Producer side
+            LogRecord *claim()
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed);
+                if (tail - head_.load(std::memory_order_acquire) >= capacity_)
+                {
+                    return nullptr;
+                }
+                return &slots_[tail & (capacity_ - 1)];
+            }
+
+            // Returns the fill level after publishing
+            std::size_t publish()
+            {
+                const auto tail = tail_.load(std::memory_order_relaxed) + 1;
+                tail_.store(tail, std::memory_order_release);
+                return tail - head_.load(std::memory_order_relaxed);
+            }
+
+            // Consumer side
+            LogRecord *front()
+            {
+                const auto head = head_.load(std::memory_order_relaxed);
+                if (head == tail_.load(std::memory_order_acquire))
+                {
+                    return nullptr;
+                }
+                return &slots_[head & (capacity_ - 1)];
+            }
+
+            void pop()
+            {
+                auto &slot = slots_[head_.load(std::memory_order_relaxed) & (capacity_ - 1)];
+                slot.heapMessage.reset();
+                head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            }
+
+            std::size_t capacity() const { return capacity_; }
+
+            // Set by the producer around its check of the running flag; see AsyncLogBackend::stop()
+            std::atomic<bool> busy{false};
+            std::atomic<bool> abandoned{false}; // the owning thread has exited
+            std::atomic<std::uint64_t> enqueued{0};
+            std::atomic<std::uint64_t> dropped{0};
+            std::atomic<std::uint64_t> blocked{0};
+
+        private:
+            std::unique_ptr<LogRecord[]> slots_;
+            std::size_t capacity_ = 0;
+            alignas(64) std::atomic<std::size_t> tail_{0};
+            alignas(64) std::atomic<std::size_t> head_{0};
+        };
+
+        // Set while the writer thread runs; constant-initialized so it outlives every Logger
+        inline std::atomic<bool> asyncLogRunning{false};
+
+        /**
+         * @brief Writer thread behind Logger's asynchronous mode
+         *
+         * Each logging thread gets its own LogRing on first use. The writer wakes every
+         * maxLatency (or at once for an ERROR or a half-full ring), merges the rings by
+         * timestamp, renders and writes the records, then flushes each logger it wrote to.
+         */
+        class AsyncLogBackend
+        {
+        public:
+            static AsyncLogBackend &instance()
+            {
+                static AsyncLogBackend backend;
+                return backend;
+            }
+
+            AsyncLogBackend(const AsyncLogBackend &) = delete;
+            AsyncLogBackend &operator=(const AsyncLogBackend &) = delete;
+
+            ~AsyncLogBackend() { stop(); }
+
+            void start(const AsyncLogOptions &options)
+            {
+                std::lock_guard<std::mutex> control(controlMutex_);
+                stopLocked();
+                {
+                    std::lock_guard<std::mutex> lock(ringsMutex_);
+                    options_ = options;
+                }
+                overflow_.store(options.overflow);
+                stopRequested_ = false;
+                asyncLogRunning.store(true);
+                writer_ = std::thread(&AsyncLogBackend::run, this);
+            }
+
+            // Writes everything queued so far; later calls log synchronously again
+            void stop()
+            {
+                std::lock_guard<std::mutex> control(controlMutex_);
+                stopLocked();
+            }
+
+            AsyncLogOptions options() const
+            {
+                std::lock_guard<std::mutex> lock(ringsMutex_);
+                return options_;
+            }
+
+            AsyncLogStats stats() const
+            {
+                std::lock_guard<std::mutex> lock(ringsMutex_);
+                AsyncLogStats result = retired_;
+                for (const auto &ring : rings_)
+                {
+                    result.enqueued += ring->enqueued.load(std::memory_order_relaxed);
+                    result.dropped += ring->dropped.load(std::memory_order_relaxed);
+                    result.blocked += ring->blocked.load(std::memory_order_relaxed);
+                }
+                result.written = written_.load(std::memory_order_relaxed);
+                result.threads = rings_.size();
+                return result;
+            }
+
+            /**
+             * @brief Queue one record built by fill(record)
+             *
+             * fill() sets everything but the timestamp/thread fields; it returns false when the
+             * record should not be queued. Returns false when the writer is not running, in
+             * which case the caller logs synchronously.
+             */
+            template <typename Fill>
+            bool enqueue(int level, bool urgent, Fill &&fill)
+            {
+                LogRing &ring = currentRing();
+                ring.busy.store(true);
+                if (!asyncLogRunning.load())
+                {
+                    ring.busy.store(false);
+                    return false;
+                }
+
+                LogRecord *slot = ring.claim();
+                if (!slot)
+                {
+                    if (overflow_.load(std::memory_order_relaxed) == LogOverflowPolicy::Drop)
+                    {
+                        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                        ring.busy.store(false);
+                        return true;
+                    }
+                    ring.blocked.fetch_add(1, std::memory_order_relaxed);
+                    wake();
+                    while (!(slot = ring.claim()))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+
+                slot->time = std::chrono::system_clock::now();
+                slot->threadId = currentThreadId();
+                slot->level = level;
+                slot->payloadSize = 0;
+                slot->format = nullptr;
+                fill(*slot);
+                const auto fillLevel = ring.publish();
+                ring.enqueued.fetch_add(1, std::memory_order_relaxed);
+                ring.busy.store(false);
+
+                if (urgent || fillLevel * 2 >= ring.capacity())
+                {
+                    wake();
+                }
+                return true;
+            }
+
+            static std::uint32_t currentThreadId()
+            {
+                thread_local const auto id =
+                    static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()) & 0xFFFFFFFFu);
+                return id;
+            }
+
+        private:
+            AsyncLogBackend() = default;
+
+            // Keeps the calling thread's ring alive and marks it abandoned when the thread exits
+            struct ThreadRing
+            {
+                std::shared_ptr<LogRing> ring;
+                ~ThreadRing()
+                {
+                    if (ring)
+                    {
+                        ring->abandoned.store(true);
+                    }
+                }
+            };
+
+            LogRing &currentRing()
+            {
+                thread_local ThreadRing local;
+                if (!local.ring)
+                {
+                    std::lock_guard<std::mutex> lock(ringsMutex_);
+                    local.ring = std::make_shared<LogRing>(options_.ringCapacity);
+                    rings_.push_back(local.ring);
+                }
+                return *local.ring;
+            }
+
+            void wake()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex_);
+                    wakeRequested_ = true;
+                }
+                wake_.notify_one();
+            }
+
+            void stopLocked()
+            {
+                if (!writer_.joinable())
+                {
+                    return;
+                }
+                asyncLogRunning.store(false);
+
+                // A producer past its running check finishes its record before we drain. The
+                // wait runs over a snapshot without ringsMutex_: a producer blocked on a full ring
+                // stays busy until the writer, which takes that mutex in drain(), frees a slot.
+                // Rings added after the snapshot see the running flag cleared and never queue.
+                std::vector<std::shared_ptr<LogRing>> rings;
+                {
+                    std::lock_guard<std::mutex> lock(ringsMutex_);
+                    rings = rings_;
+                }
+                for (const auto &ring : rings)
+                {
+                    while (ring->busy.load())
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex_);
+                    stopRequested_ = true;
+                }
+                wake_.notify_one();
+                writer_.join();
+            }
+
+            void run()
+            {
+                const auto maxLatency = options().maxLatency;
+                bool stopping = false;
+                while (!stopping)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(wakeMutex_);
+                        wake_.wait_for(lock, maxLatency, [this]
+                                       { return stopRequested_ || wakeRequested_; });
+                        stopping = stopRequested_;
+                        wakeRequested_ = false;
+                    }
+                    drain();
+                }
+            }
+
+            // Writes every visible record, oldest first across threads
+            void drain()
+            {
+                std::vector<std::shared_ptr<LogRing>> rings;
+                {
+                    std::lock_guard<std::mutex> lock(ringsMutex_);
+                    rings = rings_;
+                }
+
+                std::vector<std::pair<void *, LogRecord::Flush>> touched;
+                std::string message;
+                std::uint64_t written = 0;
+                while (true)
+                {
+                    LogRecord *oldest = nullptr;
+                    LogRing *source = nullptr;
+                    for (const auto &ring : rings)
+                    {
+                        LogRecord *front = ring->front();
+                        if (front && (!oldest || front->time < oldest->time))
+                        {
+                            oldest = front;
+                            source = ring.get();
+                        }
+                    }
+                    if (!oldest)
+                    {
+                        break;
+                    }
+
+                    message.clear();
+                    oldest->render(message, *oldest);
+                    oldest->emit(*oldest, message);
+                    const std::pair<void *, LogRecord::Flush> target{oldest->target, oldest->flush};
+                    if (std::find(touched.begin(), touched.end(), target) == touched.end())
+                    {
+                        touched.push_back(target);
+                    }
+                    source->pop();
+                    ++written;
+                }
+                for (const auto &[target, flush] : touched)
+                {
+                    flush(target);
+                }
+                written_.fetch_add(written, std::memory_order_relaxed);
+
+                // Forget rings of exited threads once they are empty
+                std::lock_guard<std::mutex> lock(ringsMutex_);
+                rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [this](const std::shared_ptr<LogRing> &ring)
+                                            {
+                                                if (!ring->abandoned.load() || ring->front())
+                                                {
+                                                    return false;
+                                                }
+                                                retired_.enqueued += ring->enqueued.load();
+                                                retired_.dropped += ring->dropped.load();
+                                                retired_.blocked += ring->blocked.load();
+                                                return true; }),
+                             rings_.end());
+            }
+
+            std::mutex controlMutex_; // serializes start() / stop()
+            mutable std::mutex ringsMutex_;
+            std::vector<std::shared_ptr<LogRing>> rings_;
+            AsyncLogOptions options_;
+            std::atomic<LogOverflowPolicy> overflow_{LogOverflowPolicy::Block};
+            AsyncLogStats retired_; // counters of rings already removed
+            std::atomic<std::uint64_t> written_{0};
+
+            std::thread writer_;
+            std::mutex wakeMutex_;
+            std::condition_variable wake_;
+            bool stopRequested_ = false;
+            bool wakeRequested_ = false;
+        };
+    } // namespace detail
+} // namespace core
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace core
+{
+    /**
+     * @brief Monotonic arena for allocations that live for one frame (or one solve)
+     *
+     * Memory is handed out from one contiguous buffer through resource() and released all at
+     * once by reset(); individual deallocations are no-ops. If a frame needs more than the
+     * buffer holds, the overflow comes from the heap and reset() grows the buffer by that much,
+     * so a steady workload stops touching the heap after its first frames.
+     *
+     * Counters cover the frame since the last reset(): allocations served, bytes requested and
+     * how many buffers had to be taken from the heap.
+     *
+     * @note Thread Safety: Not thread-safe. Use it from the thread that owns the frame.
+     */
+    class FrameArena
+    {
+    public:
+        static constexpr std::size_t DEFAULT_BYTES = 64 * 1024;
+
+        struct Stats
+        {
+            std::size_t allocations = 0;     // allocations served by the arena
+            std::size_t bytes = 0;           // bytes requested by those allocations
+            std::size_t overflowBuffers = 0; // buffers taken from the heap because the arena ran out
+            std::size_t capacity = 0;        // size of the arena's own buffer
+        };
+
+        explicit FrameArena(std::size_t initialBytes = DEFAULT_BYTES)
+            : capacity_(initialBytes == 0 ? DEFAULT_BYTES : initialBytes),
+              buffer_(std::make_unique<std::byte[]>(capacity_)),
+              upstream_(*this),
+              front_(*this)
+        {
+            arena_.emplace(buffer_.get(), capacity_, &upstream_);
+        }
+
+        FrameArena(const FrameArena &) = delete;
+        FrameArena &operator=(const FrameArena &) = delete;
+
+        // Resource for std::pmr containers; valid until the next reset()
+        std::pmr::memory_resource *resource() { return &front_; }
+
+        /**
+         * @brief Release everything allocated since the last reset
+         *
+         * Containers still holding arena memory must be gone by now. Heap overflow of the
+         * finished frame is folded into the buffer so the next frame of the same size fits.
+         */
+        void reset()
+        {
+            arena_.reset(); // returns overflow buffers to the heap
+            if (overflowBytes_ > 0)
+            {
+                capacity_ += overflowBytes_;
+                buffer_ = std::make_unique<std::byte[]>(capacity_);
+            }
+            arena_.emplace(buffer_.get(), capacity_, &upstream_);
+
+            stats_ = Stats{};
+            overflowBytes_ = 0;
+        }
+
+        Stats getStats() const
+        {
+            Stats stats = stats_;
+            stats.capacity = capacity_;
+            return stats;
+        }
+
+    private:
+        // Heap behind the arena; only reached when the buffer is exhausted
+        class Upstream : public std::pmr::memory_resource
+        {
+        public:
+            explicit Upstream(FrameArena &owner) : owner_(owner) {}
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                owner_.stats_.overflowBuffers++;
+                owner_.overflowBytes_ += bytes;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+            FrameArena &owner_;
+        };
+
+        // Counts requests, then forwards them to the current monotonic resource
+        class Front : public std::pmr::memory_resource
+        {
+        public:
+            explicit Front(FrameArena &owner) : owner_(owner) {}
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t alignment) override
+            {
+                owner_.stats_.allocations++;
+                owner_.stats_.bytes += bytes;
+                return owner_.arena_->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+            {
+                owner_.arena_->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+            FrameArena &owner_;
+        };
+
+        std::size_t capacity_;
+        std::unique_ptr<std::byte[]> buffer_;
+        Stats stats_;
+        std::size_t overflowBytes_ = 0;
+        Upstream upstream_;
+        Front front_;
+        std::optional<std::pmr::monotonic_buffer_resource> arena_;
+    };
+
+} // namespace core
@@ -15,9 +15,15 @@
 #include <type_traits>
 #include <unordered_map>
 #include <memory>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
 
 #include <thread>
 
+#include <core/AsyncLog.hpp>
+
 // Platform-specific syslog support
 #if defined(__linux__) || defined(__APPLE__)
     #include <syslog.h>
@@ -26,6 +32,15 @@
     #define LOGGER_HAS_SYSLOG 0
 #endif
 
+// Lowest level compiled in: statements below it are removed together with their arguments,
+// which are still type-checked but never evaluated. 0 = TRACE, 1 = DEBUG, 2 = INFO, 3 = WARN,
+// 4 = ERROR, 5 = NONE; set through the ADSIL_LOG_MIN_LEVEL CMake cache entry.
+#ifndef ADSIL_LOG_MIN_LEVEL
+#define ADSIL_LOG_MIN_LEVEL 0
+#endif
+
+#define LOGGER_LEVEL_COMPILED(LEVEL) (static_cast<int>(core::Logger::Level::LEVEL) >= ADSIL_LOG_MIN_LEVEL)
+
 #define LOGGER_INFO(...) LOGGER_INFO_IMPL(__VA_ARGS__)
 #define LOGGER_WARN(...) LOGGER_WARN_IMPL(__VA_ARGS__)
 #define LOGGER_ERROR(...) LOGGER_ERROR_IMPL(__VA_ARGS__)
@@ -42,19 +57,34 @@
 // Helper macro to select between named and default versions
 #define LOGGER_GET_MACRO(_1, _2, NAME, ...) NAME
 
+// Level checks come before the logger lookup and before msg is evaluated
+#define LOGGER_STATEMENT(LEVEL, LOGGER, msg)                                       \
+    do                                                                             \
+    {                                                                              \
+        if constexpr (LOGGER_LEVEL_COMPILED(LEVEL))                                \
+        {                                                                          \
+            if (core::Logger::anyLoggerEnabled(core::Logger::Level::LEVEL))        \
+            {                                                                      \
+                auto &logger_ = LOGGER;                                            \
+                if (logger_.isEnabled(core::Logger::Level::LEVEL))                 \
+                    logger_.log(#LEVEL, msg, __FILE__, __LINE__, __func__);        \
+            }                                                                      \
+        }                                                                          \
+    } while (0)
+
 // Default logger versions (1 argument)
-#define LOGGER_INFO_DEFAULT(msg) core::Logger::getInstance().log("INFO", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_WARN_DEFAULT(msg) core::Logger::getInstance().log("WARN", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_ERROR_DEFAULT(msg) core::Logger::getInstance().log("ERROR", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_DEBUG_DEFAULT(msg) core::Logger::getInstance().log("DEBUG", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_TRACE_DEFAULT(msg) core::Logger::getInstance().log("TRACE", msg, __FILE__, __LINE__, __func__)
+#define LOGGER_INFO_DEFAULT(msg) LOGGER_STATEMENT(INFO, core::Logger::getInstance(), msg)
+#define LOGGER_WARN_DEFAULT(msg) LOGGER_STATEMENT(WARN, core::Logger::getInstance(), msg)
+#define LOGGER_ERROR_DEFAULT(msg) LOGGER_STATEMENT(ERROR, core::Logger::getInstance(), msg)
+#define LOGGER_DEBUG_DEFAULT(msg) LOGGER_STATEMENT(DEBUG, core::Logger::getInstance(), msg)
+#define LOGGER_TRACE_DEFAULT(msg) LOGGER_STATEMENT(TRACE, core::Logger::getInstance(), msg)
 
 // Named logger versions (2 arguments)
-#define LOGGER_INFO_NAMED(name, msg) core::Logger::getInstance(name).log("INFO", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_WARN_NAMED(name, msg) core::Logger::getInstance(name).log("WARN", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_ERROR_NAMED(name, msg) core::Logger::getInstance(name).log("ERROR", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_DEBUG_NAMED(name, msg) core::Logger::getInstance(name).log("DEBUG", msg, __FILE__, __LINE__, __func__)
-#define LOGGER_TRACE_NAMED(name, msg) core::Logger::getInstance(name).log("TRACE", msg, __FILE__, __LINE__, __func__)
+#define LOGGER_INFO_NAMED(name, msg) LOGGER_STATEMENT(INFO, core::Logger::getInstance(name), msg)
+#define LOGGER_WARN_NAMED(name, msg) LOGGER_STATEMENT(WARN, core::Logger::getInstance(name), msg)
+#define LOGGER_ERROR_NAMED(name, msg) LOGGER_STATEMENT(ERROR, core::Logger::getInstance(name), msg)
+#define LOGGER_DEBUG_NAMED(name, msg) LOGGER_STATEMENT(DEBUG, core::Logger::getInstance(name), msg)
+#define LOGGER_TRACE_NAMED(name, msg) LOGGER_STATEMENT(TRACE, core::Logger::getInstance(name), msg)
 
 // Enhanced macros with format support and early level check
 #define LOGGER_INFO_F(...) LOGGER_INFO_F_IMPL(__VA_ARGS__)
@@ -73,107 +103,33 @@
 // Helper macro for format versions (needs at least 2 args)
 #define LOGGER_GET_F_MACRO(_1, _2, _3, NAME, ...) NAME
 
-// Default format versions
-#define LOGGER_INFO_F_DEFAULT(fmt, ...)                                                           \
-    do                                                                                            \
-    {                                                                                             \
-        if (core::Logger::getInstance().getCurrentLevel() <= core::Logger::Level::INFO)           \
-        {                                                                                         \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                   \
-            core::Logger::getInstance().log("INFO", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                         \
-    } while (0)
-
-#define LOGGER_WARN_F_DEFAULT(fmt, ...)                                                           \
-    do                                                                                            \
-    {                                                                                             \
-        if (core::Logger::getInstance().getCurrentLevel() <= core::Logger::Level::WARN)           \
-        {                                                                                         \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                   \
-            core::Logger::getInstance().log("WARN", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                         \
-    } while (0)
-
-#define LOGGER_ERROR_F_DEFAULT(fmt, ...)                                                           \
-    do                                                                                             \
-    {                                                                                              \
-        if (core::Logger::getInstance().getCurrentLevel() <= core::Logger::Level::ERROR)           \
-        {                                                                                          \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                    \
-            core::Logger::getInstance().log("ERROR", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                          \
-    } while (0)
-
-#define LOGGER_DEBUG_F_DEFAULT(fmt, ...)                                                           \
-    do                                                                                             \
-    {                                                                                              \
-        if (core::Logger::getInstance().getCurrentLevel() <= core::Logger::Level::DEBUG)           \
-        {                                                                                          \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                    \
-            core::Logger::getInstance().log("DEBUG", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                          \
+#define LOGGER_FORMAT_STATEMENT(LEVEL, LOGGER, fmt, ...)                                                                \
+    do                                                                                                                  \
+    {                                                                                                                   \
+        if constexpr (LOGGER_LEVEL_COMPILED(LEVEL))                                                                     \
+        {                                                                                                               \
+            if (core::Logger::anyLoggerEnabled(core::Logger::Level::LEVEL))                                             \
+            {                                                                                                           \
+                auto &logger_ = LOGGER;                                                                                 \
+                if (logger_.isEnabled(core::Logger::Level::LEVEL))                                                      \
+                    logger_.logFormat(core::Logger::Level::LEVEL, fmt, __FILE__, __LINE__, __func__, __VA_ARGS__);      \
+            }                                                                                                           \
+        }                                                                                                               \
     } while (0)
 
-#define LOGGER_TRACE_F_DEFAULT(fmt, ...)                                                           \
-    do                                                                                             \
-    {                                                                                              \
-        if (core::Logger::getInstance().getCurrentLevel() <= core::Logger::Level::TRACE)           \
-        {                                                                                          \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                    \
-            core::Logger::getInstance().log("TRACE", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                          \
-    } while (0)
+// Default format versions
+#define LOGGER_INFO_F_DEFAULT(fmt, ...) LOGGER_FORMAT_STATEMENT(INFO, core::Logger::getInstance(), fmt, __VA_ARGS__)
+#define LOGGER_WARN_F_DEFAULT(fmt, ...) LOGGER_FORMAT_STATEMENT(WARN, core::Logger::getInstance(), fmt, __VA_ARGS__)
+#define LOGGER_ERROR_F_DEFAULT(fmt, ...) LOGGER_FORMAT_STATEMENT(ERROR, core::Logger::getInstance(), fmt, __VA_ARGS__)
+#define LOGGER_DEBUG_F_DEFAULT(fmt, ...) LOGGER_FORMAT_STATEMENT(DEBUG, core::Logger::getInstance(), fmt, __VA_ARGS__)
+#define LOGGER_TRACE_F_DEFAULT(fmt, ...) LOGGER_FORMAT_STATEMENT(TRACE, core::Logger::getInstance(), fmt, __VA_ARGS__)
 
 // Named format versions
-#define LOGGER_INFO_F_NAMED(name, fmt, ...)                                                           \
-    do                                                                                                \
-    {                                                                                                 \
-        if (core::Logger::getInstance(name).getCurrentLevel() <= core::Logger::Level::INFO)           \
-        {                                                                                             \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                       \
-            core::Logger::getInstance(name).log("INFO", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                             \
-    } while (0)
-
-#define LOGGER_WARN_F_NAMED(name, fmt, ...)                                                           \
-    do                                                                                                \
-    {                                                                                                 \
-        if (core::Logger::getInstance(name).getCurrentLevel() <= core::Logger::Level::WARN)           \
-        {                                                                                             \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                       \
-            core::Logger::getInstance(name).log("WARN", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                             \
-    } while (0)
-
-#define LOGGER_ERROR_F_NAMED(name, fmt, ...)                                                           \
-    do                                                                                                 \
-    {                                                                                                  \
-        if (core::Logger::getInstance(name).getCurrentLevel() <= core::Logger::Level::ERROR)           \
-        {                                                                                              \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                        \
-            core::Logger::getInstance(name).log("ERROR", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                              \
-    } while (0)
-
-#define LOGGER_DEBUG_F_NAMED(name, fmt, ...)                                                           \
-    do                                                                                                 \
-    {                                                                                                  \
-        if (core::Logger::getInstance(name).getCurrentLevel() <= core::Logger::Level::DEBUG)           \
-        {                                                                                              \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                        \
-            core::Logger::getInstance(name).log("DEBUG", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                              \
-    } while (0)
-
-#define LOGGER_TRACE_F_NAMED(name, fmt, ...)                                                           \
-    do                                                                                                 \
-    {                                                                                                  \
-        if (core::Logger::getInstance(name).getCurrentLevel() <= core::Logger::Level::TRACE)           \
-        {                                                                                              \
-            std::string formatted_msg = core::detail::format(fmt, __VA_ARGS__);                        \
-            core::Logger::getInstance(name).log("TRACE", formatted_msg, __FILE__, __LINE__, __func__); \
-        }                                                                                              \
-    } while (0)
+#define LOGGER_INFO_F_NAMED(name, fmt, ...) LOGGER_FORMAT_STATEMENT(INFO, core::Logger::getInstance(name), fmt, __VA_ARGS__)
+#define LOGGER_WARN_F_NAMED(name, fmt, ...) LOGGER_FORMAT_STATEMENT(WARN, core::Logger::getInstance(name), fmt, __VA_ARGS__)
+#define LOGGER_ERROR_F_NAMED(name, fmt, ...) LOGGER_FORMAT_STATEMENT(ERROR, core::Logger::getInstance(name), fmt, __VA_ARGS__)
+#define LOGGER_DEBUG_F_NAMED(name, fmt, ...) LOGGER_FORMAT_STATEMENT(DEBUG, core::Logger::getInstance(name), fmt, __VA_ARGS__)
+#define LOGGER_TRACE_F_NAMED(name, fmt, ...) LOGGER_FORMAT_STATEMENT(TRACE, core::Logger::getInstance(name), fmt, __VA_ARGS__)
 
 // Conditional logging macros
 #define LOGGER_INFO_IF(condition, msg) \
@@ -190,6 +146,32 @@
             LOGGER_ERROR(msg);          \
     } while (0)
 
+// Sampled and rate-limited logging for hot paths; the state is per call site and shared by all
+// threads. *_EVERY_N(n, ...) logs the 1st, (n+1)th, (2n+1)th... call; *_EVERY_MS(ms, ...) logs
+// at most once per ms milliseconds. The remaining arguments are those of LOGGER_INFO and friends.
+#define LOGGER_SAMPLED(LEVEL, TEST, STATEMENT)                                               \
+    do                                                                                       \
+    {                                                                                        \
+        if constexpr (LOGGER_LEVEL_COMPILED(LEVEL))                                          \
+        {                                                                                    \
+            static core::detail::LogSite logSite_;                                           \
+            if (core::Logger::anyLoggerEnabled(core::Logger::Level::LEVEL) && logSite_.TEST) \
+                STATEMENT;                                                                   \
+        }                                                                                    \
+    } while (0)
+
+#define LOGGER_INFO_EVERY_N(n, ...) LOGGER_SAMPLED(INFO, everyN(n), LOGGER_INFO(__VA_ARGS__))
+#define LOGGER_WARN_EVERY_N(n, ...) LOGGER_SAMPLED(WARN, everyN(n), LOGGER_WARN(__VA_ARGS__))
+#define LOGGER_ERROR_EVERY_N(n, ...) LOGGER_SAMPLED(ERROR, everyN(n), LOGGER_ERROR(__VA_ARGS__))
+#define LOGGER_DEBUG_EVERY_N(n, ...) LOGGER_SAMPLED(DEBUG, everyN(n), LOGGER_DEBUG(__VA_ARGS__))
+#define LOGGER_TRACE_EVERY_N(n, ...) LOGGER_SAMPLED(TRACE, everyN(n), LOGGER_TRACE(__VA_ARGS__))
+
+#define LOGGER_INFO_EVERY_MS(ms, ...) LOGGER_SAMPLED(INFO, everyMs(ms), LOGGER_INFO(__VA_ARGS__))
+#define LOGGER_WARN_EVERY_MS(ms, ...) LOGGER_SAMPLED(WARN, everyMs(ms), LOGGER_WARN(__VA_ARGS__))
+#define LOGGER_ERROR_EVERY_MS(ms, ...) LOGGER_SAMPLED(ERROR, everyMs(ms), LOGGER_ERROR(__VA_ARGS__))
+#define LOGGER_DEBUG_EVERY_MS(ms, ...) LOGGER_SAMPLED(DEBUG, everyMs(ms), LOGGER_DEBUG(__VA_ARGS__))
+#define LOGGER_TRACE_EVERY_MS(ms, ...) LOGGER_SAMPLED(TRACE, everyMs(ms), LOGGER_TRACE(__VA_ARGS__))
+
 namespace core
 {
     // Optimized formatting utility for logger
@@ -313,6 +295,41 @@ namespace core
             result += fmt.substr(pos + 2);
             return result;
         }
+
+        /**
+         * @brief State of one LOGGER_*_EVERY_N / LOGGER_*_EVERY_MS call site
+         *
+         * Lock-free; concurrent callers share the count and the interval.
+         */
+        class LogSite
+        {
+        public:
+            // True for the 1st, (n+1)th, (2n+1)th... call
+            bool everyN(std::uint64_t n)
+            {
+                const auto call = calls_.fetch_add(1, std::memory_order_relaxed);
+                return n <= 1 || call % n == 0;
+            }
+
+            // True for the first call and then at most once per period
+            bool everyMs(std::int64_t periodMs)
+            {
+                const std::int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                             std::chrono::steady_clock::now().time_since_epoch())
+                                             .count();
+                std::int64_t last = lastMs_.load(std::memory_order_relaxed);
+                if (last != NEVER && now - last < periodMs)
+                    return false;
+                // Only one of the threads racing past the check gets to log
+                return lastMs_.compare_exchange_strong(last, now, std::memory_order_relaxed);
+            }
+
+        private:
+            static constexpr std::int64_t NEVER = std::numeric_limits<std::int64_t>::min();
+
+            std::atomic<std::uint64_t> calls_{0};
+            std::atomic<std::int64_t> lastMs_{NEVER};
+        };
     }
 
     class Logger
@@ -417,8 +434,24 @@ namespace core
 
         void setLevel(Level level)
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            minLevel_ = level;
+            minLevel_.store(level, std::memory_order_relaxed);
+            updateLowestLevel();
+        }
+
+        bool isEnabled(Level level) const
+        {
+            return level >= minLevel_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief False when no logger accepts level, checked by the macros before looking up a logger
+         *
+         * The macros create a channel's logger on first use, so the level new loggers start at
+         * (ADSIL_LOG_LEVEL, or TRACE) counts too: without ADSIL_LOG_LEVEL nothing is filtered here.
+         */
+        static bool anyLoggerEnabled(Level level)
+        {
+            return level >= lowestLevel().load(std::memory_order_relaxed);
         }
 
         // Main log function with source location
@@ -426,52 +459,99 @@ namespace core
                  const char *file = nullptr, int line = 0, const char *func = nullptr)
         {
             Level level = parseLevel(levelStr);
-            if (level < minLevel_)
+            if (!isEnabled(level))
                 return;
 
-            std::lock_guard<std::mutex> lock(mutex_);
-            std::string timestamp = getTimestamp();
-            std::string threadId = getThreadId();
-
-#if LOGGER_HAS_SYSLOG
-            if (useSyslog_)
+            // Asynchronous mode: copy the message into this thread's ring and return
+            if (detail::asyncLogRunning.load(std::memory_order_relaxed) &&
+                detail::AsyncLogBackend::instance().enqueue(static_cast<int>(level), level >= Level::ERROR, [&](detail::LogRecord &record)
+                                                            {
+                                                                fillRecord(record, file, line, func);
+                                                                record.render = &detail::renderLogMessage;
+                                                                detail::LogPayloadWriter writer(record);
+                                                                writer.text(msg);
+                                                                if (writer.overflow)
+                                                                {
+                                                                    record.heapMessage = std::make_unique<std::string>(msg);
+                                                                } }))
             {
-                int syslogLevel = LOG_INFO;
-                if (level == Level::ERROR)
-                    syslogLevel = LOG_ERR;
-                else if (level == Level::WARN)
-                    syslogLevel = LOG_WARNING;
-                else if (level == Level::DEBUG)
-                    syslogLevel = LOG_DEBUG;
-                else if (level == Level::TRACE)
-                    syslogLevel = LOG_DEBUG; // Use DEBUG for TRACE in syslog
-
-                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, false);
-                syslog(syslogLevel, "%s", formatted.c_str());
-            }
-            else
-#endif
-            if (logFile_.is_open() && !logFileFailed_)
-            {
-                // Format for file without colors
-                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, fileColorOutput_);
-                logFile_ << formatted << std::endl;
-                // Check for write errors
-                if (logFile_.fail())
-                {
-                    logFileFailed_ = true;
-                    std::cerr << "[LOGGER ERROR] Failed to write to log file, falling back to stderr" << std::endl;
-                    // Format for console with colors
-                    std::string consoleFormatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, colorOutput_);
-                    std::cerr << consoleFormatted << std::endl;
-                }
+                return;
             }
-            else
+
+            write(level, msg, std::chrono::system_clock::now(), detail::AsyncLogBackend::currentThreadId(), file, line, func, true);
+        }
+
+        /**
+         * @brief Log with "{}" placeholders, formatted on the writer thread in asynchronous mode
+         *
+         * fmt must outlive the call (a string literal): only the pointer and the arguments are
+         * queued. Numbers are stored by value, text is copied, other types are rendered with
+         * operator<< up front. Without the asynchronous writer this formats and logs at once.
+         */
+        template <typename... Args>
+        void logFormat(Level level, const char *fmt, const char *file, int line, const char *func, const Args &...args)
+        {
+            if (!isEnabled(level))
+                return;
+
+            if (detail::asyncLogRunning.load(std::memory_order_relaxed) &&
+                detail::AsyncLogBackend::instance().enqueue(static_cast<int>(level), level >= Level::ERROR, [&](detail::LogRecord &record)
+                                                            {
+                                                                fillRecord(record, file, line, func);
+                                                                detail::LogPayloadWriter writer(record);
+                                                                (detail::encodeLogArg(writer, args), ...);
+                                                                if (writer.overflow)
+                                                                {
+                                                                    record.render = &detail::renderLogMessage;
+                                                                    record.heapMessage = std::make_unique<std::string>(detail::format(fmt, args...));
+                                                                }
+                                                                else
+                                                                {
+                                                                    record.format = fmt;
+                                                                    record.render = &detail::renderLogFormat<std::decay_t<Args>...>;
+                                                                } }))
             {
-                // Format for console with colors
-                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, colorOutput_);
-                std::cerr << formatted << std::endl;
+                return;
             }
+
+            log(levelName(level), detail::format(fmt, args...), file, line, func);
+        }
+
+        // Format strings that are not literals are formatted at the call site
+        template <typename... Args>
+        void logFormat(Level level, const std::string &fmt, const char *file, int line, const char *func, const Args &...args)
+        {
+            if (!isEnabled(level))
+                return;
+            log(levelName(level), detail::format(fmt, args...), file, line, func);
+        }
+
+        /**
+         * @brief Move formatting and file writes of every logger to a background thread
+         *
+         * Log calls then only copy a fixed-size record into a per-thread ring. Records reach
+         * the log within options.maxLatency (ERROR records at once). Calling it again applies
+         * new options; stopAsync() writes what is queued and returns to synchronous logging.
+         */
+        static void startAsync(const AsyncLogOptions &options = {})
+        {
+            detail::AsyncLogBackend::instance().start(options);
+        }
+
+        static void stopAsync()
+        {
+            if (detail::asyncLogRunning.load())
+                detail::AsyncLogBackend::instance().stop();
+        }
+
+        static bool isAsync()
+        {
+            return detail::asyncLogRunning.load();
+        }
+
+        static AsyncLogStats getAsyncStats()
+        {
+            return detail::AsyncLogBackend::instance().stats();
         }
 
     public:
@@ -505,8 +585,7 @@ namespace core
         // Get current configuration state
         Level getCurrentLevel() const
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            return minLevel_;
+            return minLevel_.load(std::memory_order_relaxed);
         }
 
         bool isFileLoggingEnabled() const
@@ -522,6 +601,9 @@ namespace core
 
         ~Logger()
         {
+            // Queued records may still point at this logger
+            stopAsync();
+            unregisterLogger();
             if (logFile_.is_open())
                 logFile_.close();
         }
@@ -539,6 +621,7 @@ namespace core
                    maxMessageLength_(DEFAULT_MAX_MESSAGE_LENGTH)
         {
             initializeFromEnvironment();
+            registerLogger();
         }
 
         Logger(const std::string &name) : name_(name), minLevel_(Level::TRACE), useSyslog_(false), showThreadId_(false),
@@ -546,12 +629,68 @@ namespace core
                                           maxMessageLength_(DEFAULT_MAX_MESSAGE_LENGTH)
         {
             initializeFromEnvironment();
+            registerLogger();
         }
         Logger(const Logger &) = delete;
         Logger &operator=(const Logger &) = delete;
 
+        // Every live logger, so anyLoggerEnabled() can track the lowest level among them
+        struct LoggerRegistry
+        {
+            std::mutex mutex;
+            std::vector<const Logger *> loggers;
+        };
+
+        static LoggerRegistry &registry()
+        {
+            // Never destroyed: loggers in other static objects unregister during exit
+            static LoggerRegistry *instance = new LoggerRegistry;
+            return *instance;
+        }
+
+        static std::atomic<Level> &lowestLevel()
+        {
+            static std::atomic<Level> level{Level::TRACE};
+            return level;
+        }
+
+        // Level a new logger starts at: ADSIL_LOG_LEVEL, or TRACE when unset or invalid
+        static Level initialLevel()
+        {
+            const char *logLevel = std::getenv("ADSIL_LOG_LEVEL");
+            const Level level = logLevel ? parseLevel(std::string(logLevel)) : Level::NONE;
+            return level != Level::NONE ? level : Level::TRACE;
+        }
+
+        void registerLogger()
+        {
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.loggers.push_back(this);
+            if (getCurrentLevel() < lowestLevel().load())
+                lowestLevel().store(getCurrentLevel());
+        }
+
+        void unregisterLogger()
+        {
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.loggers.erase(std::remove(reg.loggers.begin(), reg.loggers.end(), this), reg.loggers.end());
+        }
+
+        static void updateLowestLevel()
+        {
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            // Loggers not created yet count as well; they start at initialLevel()
+            Level lowest = initialLevel();
+            for (const Logger *logger : reg.loggers)
+                lowest = std::min(lowest, logger->getCurrentLevel());
+            lowestLevel().store(lowest);
+        }
+
         std::string name_;
-        Level minLevel_;
+        std::atomic<Level> minLevel_;
         std::ofstream logFile_;
         std::string logFilePath_; // Store the log file path for clearing
         mutable std::mutex mutex_;
@@ -577,7 +716,103 @@ namespace core
         }
 
     private:
-        Level parseLevel(const std::string &levelStr) const
+        // Writes one line to syslog, the log file or stderr; shared by the synchronous path and
+        // the asynchronous writer thread (which flushes once per batch instead of per line)
+        void write(Level level, const std::string &msg, std::chrono::system_clock::time_point time,
+                   std::uint32_t threadHash, const char *file, int line, const char *func, bool flushLine)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const std::string levelStr = levelName(level);
+            std::string timestamp = getTimestamp(time);
+            std::string threadId = getThreadId(threadHash);
+
+#if LOGGER_HAS_SYSLOG
+            if (useSyslog_)
+            {
+                int syslogLevel = LOG_INFO;
+                if (level == Level::ERROR)
+                    syslogLevel = LOG_ERR;
+                else if (level == Level::WARN)
+                    syslogLevel = LOG_WARNING;
+                else if (level == Level::DEBUG)
+                    syslogLevel = LOG_DEBUG;
+                else if (level == Level::TRACE)
+                    syslogLevel = LOG_DEBUG; // Use DEBUG for TRACE in syslog
+
+                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, false);
+                syslog(syslogLevel, "%s", formatted.c_str());
+            }
+            else
+#endif
+            if (logFile_.is_open() && !logFileFailed_)
+            {
+                // Format for file without colors
+                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, fileColorOutput_);
+                logFile_ << formatted << '\n';
+                if (flushLine)
+                    logFile_.flush();
+                // Check for write errors
+                if (logFile_.fail())
+                {
+                    logFileFailed_ = true;
+                    std::cerr << "[LOGGER ERROR] Failed to write to log file, falling back to stderr" << std::endl;
+                    // Format for console with colors
+                    std::string consoleFormatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, colorOutput_);
+                    std::cerr << consoleFormatted << std::endl;
+                }
+            }
+            else
+            {
+                // Format for console with colors
+                std::string formatted = formatLog(levelStr, msg, timestamp, threadId, file, line, func, colorOutput_);
+                std::cerr << formatted << std::endl;
+            }
+        }
+
+        void fillRecord(detail::LogRecord &record, const char *file, int line, const char *func)
+        {
+            record.target = this;
+            record.emit = &Logger::emitRecord;
+            record.flush = &Logger::flushTarget;
+            record.file = file;
+            record.line = line;
+            record.func = func;
+        }
+
+        // Writer-thread callbacks of the asynchronous backend
+        static void emitRecord(const detail::LogRecord &record, const std::string &message)
+        {
+            static_cast<Logger *>(record.target)->write(static_cast<Level>(record.level), message, record.time, record.threadId, record.file, record.line, record.func, false);
+        }
+
+        static void flushTarget(void *target)
+        {
+            auto *logger = static_cast<Logger *>(target);
+            std::lock_guard<std::mutex> lock(logger->mutex_);
+            if (logger->logFile_.is_open())
+                logger->logFile_.flush();
+        }
+
+        static const char *levelName(Level level)
+        {
+            switch (level)
+            {
+            case Level::TRACE:
+                return "TRACE";
+            case Level::DEBUG:
+                return "DEBUG";
+            case Level::INFO:
+                return "INFO";
+            case Level::WARN:
+                return "WARN";
+            case Level::ERROR:
+                return "ERROR";
+            default:
+                return "NONE";
+            }
+        }
+
+        static Level parseLevel(const std::string &levelStr)
         {
             if (levelStr == "TRACE")
                 return Level::TRACE;
@@ -610,9 +845,8 @@ namespace core
             return "\033[0m";      // Reset/default
         }
 
-        std::string getTimestamp() const
+        std::string getTimestamp(std::chrono::system_clock::time_point now) const
         {
-            auto now = std::chrono::system_clock::now();
             auto in_time_t = std::chrono::system_clock::to_time_t(now);
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
 
@@ -626,11 +860,9 @@ namespace core
             return std::string(result);
         }
 
-        std::string getThreadId() const
+        // Hash of the logging thread's id, captured at the call (see AsyncLogBackend::currentThreadId)
+        std::string getThreadId(std::uint32_t hash) const
         {
-            // More efficient thread ID formatting
-            std::hash<std::thread::id> hasher;
-            auto hash = hasher(std::this_thread::get_id());
             char buffer[THREAD_ID_BUFFER_SIZE];
             std::snprintf(buffer, sizeof(buffer), "%08x", static_cast<unsigned int>(hash & THREAD_ID_HASH_MASK));
             return std::string(buffer);
@@ -716,7 +948,7 @@ namespace core
             {
                 Level level = parseLevel(std::string(logLevel));
                 if (level != Level::NONE)
-                    minLevel_ = level;
+                    minLevel_.store(level, std::memory_order_relaxed);
             }
 
             // Check for log file environment variable
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace core
+{
+    /**
+     * @brief Bounded lock-free queue for many producers and one consumer
+     *
+     * A ring of slots, each carrying a sequence number that says whose turn it is (producer
+     * or consumer) for that slot. Producers claim a slot with one compare-and-swap on the
+     * write position; neither side ever takes a lock or waits for the other. A full queue
+     * makes tryPush() fail instead of blocking, so the producer decides whether to drop.
+     *
+     * Capacity is rounded up to a power of two.
+     *
+     * @note Thread Safety: tryPush() may be called from any number of threads; tryPop() from
+     *       one thread at a time.
+     */
+    template <typename T>
+    class MpscQueue
+    {
+    public:
+        explicit MpscQueue(std::size_t capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("MpscQueue: capacity must be positive");
+            }
+            capacity_ = 1;
+            while (capacity_ < capacity)
+            {
+                capacity_ <<= 1;
+            }
+            mask_ = capacity_ - 1;
+
+            slots_ = std::make_unique<Slot[]>(capacity_);
+            for (std::size_t i = 0; i < capacity_; ++i)
+            {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        // False (and value untouched) when the queue is full
+        bool tryPush(T value)
+        {
+            std::size_t position = writePos_.load(std::memory_order_relaxed);
+            Slot *slot = nullptr;
+            while (true)
+            {
+                slot = &slots_[position & mask_];
+                const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const auto lag = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+                if (lag == 0)
+                {
+                    if (writePos_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false; // the consumer has not freed this slot yet
+                }
+                else
+                {
+                    position = writePos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            slot->value = std::move(value);
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // False when nothing is ready; a slot claimed but not yet filled counts as not ready
+        bool tryPop(T &out)
+        {
+            const std::size_t position = readPos_.load(std::memory_order_relaxed);
+            Slot &slot = slots_[position & mask_];
+            if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+            {
+                return false;
+            }
+
+            out = std::move(slot.value);
+            slot.sequence.store(position + capacity_, std::memory_order_release);
+            readPos_.store(position + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        std::size_t capacity() const { return capacity_; }
+
+        // Approximate while producers are active
+        std::size_t sizeApprox() const
+        {
+            const std::size_t written = writePos_.load(std::memory_order_relaxed);
+            const std::size_t read = readPos_.load(std::memory_order_relaxed);
+            return written > read ? written - read : 0;
+        }
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence{0};
+            T value{};
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t capacity_ = 0;
+        std::size_t mask_ = 0;
+
+        // Producers and the consumer write different cache lines; only the consumer writes readPos_
+        alignas(64) std::atomic<std::size_t> writePos_{0};
+        alignas(64) std::atomic<std::size_t> readPos_{0};
+    };
+
+} // namespace core
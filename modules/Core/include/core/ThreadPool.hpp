@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace core
+{
+    /**
+     * @brief Persistent pool of worker threads
+     *
+     * Workers are started once and wait for tasks, so per-frame parallel work does not
+     * pay thread creation costs. parallelFor() splits an index range over the workers
+     * and the calling thread and blocks until every index ran.
+     *
+     * Determinism is left to the caller: tasks should write to disjoint, index-addressed
+     * slots and merge them in index order afterwards.
+     *
+     * @note Thread Safety: submit() and parallelFor() may be called from any thread.
+     *       parallelFor() must not be called from inside a pool task.
+     */
+    class ThreadPool
+    {
+    public:
+        /**
+         * @param workerCount Number of worker threads; 0 picks hardware_concurrency() - 1
+         *        so that workers plus the calling thread fill the machine
+         */
+        explicit ThreadPool(std::size_t workerCount = 0)
+        {
+            if (workerCount == 0)
+            {
+                const unsigned int hw = std::thread::hardware_concurrency();
+                workerCount = hw > 1 ? hw - 1 : 1;
+            }
+
+            workers_.reserve(workerCount);
+            for (std::size_t i = 0; i < workerCount; ++i)
+            {
+                workers_.emplace_back([this]
+                                      { workerLoop(); });
+            }
+        }
+
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            condition_.notify_all();
+            for (auto &worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        std::size_t getWorkerCount() const { return workers_.size(); }
+
+        /**
+         * @brief Queue a task for the next free worker
+         * @return Future that becomes ready when the task finished (or rethrows its exception)
+         */
+        std::future<void> submit(std::function<void()> task)
+        {
+            auto packaged = std::make_shared<std::packaged_task<void()>>(std::move(task));
+            auto future = packaged->get_future();
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                tasks_.emplace([packaged]
+                               { (*packaged)(); });
+            }
+            condition_.notify_one();
+            return future;
+        }
+
+        /**
+         * @brief Run body(i) for every i in [0, count), spread over workers and the caller
+         *
+         * Indices are handed out one at a time from a shared counter, so uneven task costs
+         * balance out. The first exception thrown by body is rethrown after all indices ran.
+         */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)> &body)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            std::atomic<std::size_t> next{0};
+            std::exception_ptr firstError;
+            std::mutex errorMutex;
+
+            auto drain = [&]
+            {
+                for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+                {
+                    try
+                    {
+                        body(i);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(errorMutex);
+                        if (!firstError)
+                        {
+                            firstError = std::current_exception();
+                        }
+                    }
+                }
+            };
+
+            const std::size_t helpers = std::min(workers_.size(), count - 1);
+            std::vector<std::future<void>> pending;
+            pending.reserve(helpers);
+            for (std::size_t i = 0; i < helpers; ++i)
+            {
+                pending.push_back(submit(drain));
+            }
+
+            drain();
+            for (auto &future : pending)
+            {
+                future.get();
+            }
+
+            if (firstError)
+            {
+                std::rethrow_exception(firstError);
+            }
+        }
+
+    private:
+        void workerLoop()
+        {
+            while (true)
+            {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    condition_.wait(lock, [this]
+                                    { return stopping_ || !tasks_.empty(); });
+                    if (stopping_ && tasks_.empty())
+                    {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop();
+                }
+                task();
+            }
+        }
+
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        bool stopping_ = false;
+    };
+
+} // namespace core
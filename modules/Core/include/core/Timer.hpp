@@ -1,28 +1,50 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <unordered_map>
 #include <iostream>
 #include <iomanip>
 #include <functional>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Timers are compiled out in Release builds (NDEBUG) unless built with -DADSIL_TIMERS=1
+#ifndef ADSIL_TIMERS
+#ifdef NDEBUG
+#define ADSIL_TIMERS 0
+#else
+#define ADSIL_TIMERS 1
+#endif
+#endif
+
+// Id of a timer name, interned the first time the call site runs; name must not change between runs
+#define TIMER_ID(name) ([&] { static const core::Timer::Id timerId_ = core::Timer::id(name); return timerId_; }())
 
 // Convenience macros for quick timing measurements
-#define TIMER_START(name) core::Timer::start(name)
-#define TIMER_END(name) core::Timer::end(name)
-#define TIMER_SCOPE(name) core::ScopedTimer _scoped_timer_(name)
-#define TIMER_FUNCTION() core::ScopedTimer _function_timer_(__func__)
+#define TIMER_START(name) core::Timer::start(TIMER_ID(name))
+#define TIMER_END(name) core::Timer::end(TIMER_ID(name))
+#define TIMER_SCOPE(name) core::ScopedTimer _scoped_timer_(TIMER_ID(name))
+#define TIMER_FUNCTION()                                                                   \
+    static const core::Timer::Id _function_timer_id_ = core::Timer::id(__func__);          \
+    core::ScopedTimer _function_timer_(_function_timer_id_)
 #define TIMER_REPORT() core::Timer::report()
 #define TIMER_RESET() core::Timer::reset()
 
 // Advanced timing macros
-#define TIMER_BLOCK(name) for (core::ScopedTimer _block_timer_(name); !_block_timer_.isDone(); _block_timer_.markDone())
-#define TIMER_MEASURE(name, code) \
-    do                            \
-    {                             \
-        core::Timer::start(name); \
-        code;                     \
-        core::Timer::end(name);   \
+#define TIMER_BLOCK(name) for (core::ScopedTimer _block_timer_(TIMER_ID(name)); !_block_timer_.isDone(); _block_timer_.markDone())
+#define TIMER_MEASURE(name, code)                          \
+    do                                                     \
+    {                                                      \
+        core::ScopedTimer _measure_timer_(TIMER_ID(name)); \
+        code;                                              \
     } while (0)
 
 namespace core
@@ -32,12 +54,12 @@ namespace core
      *
      * Features:
      * - Zero-overhead when disabled (compile-time optimization)
-     * - Minimal memory footprint using static storage
-     * - Thread-safe operations
+     * - Names are interned once per call site; measurements work on small integer ids
+     * - Thread-safe: each thread records into its own slots without locks or allocation
+     * - Reports merge the slots of every thread, including threads that have finished
      * - Nanosecond precision using steady_clock
      * - Multiple timing modes: manual, scoped, and lambda-based
      * - Accumulative timing for repeated operations
-     * - Memory-efficient string key storage with small string optimization
      *
      * Usage patterns:
      * 1. Manual timing: Timer::start("operation") ... Timer::end("operation")
@@ -45,6 +67,9 @@ namespace core
      * 3. Block timing: TIMER_BLOCK("operation") { ... }
      * 4. Function timing: TIMER_FUNCTION() at function start
      * 5. Lambda timing: Timer::measure("operation", []() { ... })
+     *
+     * The overloads taking a name look the name up under a lock on every call; the macros
+     * and the Id overloads do not.
      */
     class Timer
     {
@@ -52,6 +77,10 @@ namespace core
         using Clock = std::chrono::steady_clock;
         using TimePoint = Clock::time_point;
         using Duration = std::chrono::nanoseconds;
+        using Id = std::uint32_t;
+
+        // Distinct timer names per process; every thread that records has this many slots
+        static constexpr std::size_t MAX_TIMERS = 256;
 
         // Performance statistics for a timer
         struct TimerStats
@@ -71,62 +100,119 @@ namespace core
 
             double averageMs() const
             {
-                return count > 0 ? (total.count() / static_cast<double>(count)) / 1e6 : 0.0;
+                return count > 0 ? (static_cast<double>(total.count()) / static_cast<double>(count)) / 1e6 : 0.0;
             }
 
             double totalMs() const
             {
-                return total.count() / 1e6;
+                return static_cast<double>(total.count()) / 1e6;
             }
 
             double minMs() const
             {
-                return min.count() / 1e6;
+                return static_cast<double>(min.count()) / 1e6;
             }
 
             double maxMs() const
             {
-                return max.count() / 1e6;
+                return static_cast<double>(max.count()) / 1e6;
             }
         };
 
         /**
-         * @brief Start timing for a named operation
+         * @brief Intern a timer name
+         *
+         * The same name always gets the same id. Takes a lock, so call it once per call site
+         * (TIMER_ID does) rather than per measurement.
+         * @throws std::runtime_error if more than MAX_TIMERS names are used
+         */
+        static Id id(const std::string &name)
+        {
+            auto &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            auto it = reg.ids.find(name);
+            if (it != reg.ids.end())
+                return it->second;
+            if (reg.names.size() >= MAX_TIMERS)
+                throw std::runtime_error("Timer: more than " + std::to_string(MAX_TIMERS) + " timer names");
+            const auto newId = static_cast<Id>(reg.names.size());
+            reg.names.push_back(name);
+            reg.ids.emplace(name, newId);
+            return newId;
+        }
+
+        /**
+         * @brief Start timing for a named operation on the calling thread
          * @param name Unique name for the timer
          */
-        static void start(const std::string &name)
+        static void start(Id timer)
         {
             if constexpr (TIMER_ENABLED)
             {
-                getStartTimes()[name] = Clock::now();
+                startTimes_[timer] = Clock::now();
             }
         }
 
+        static void start(const std::string &name)
+        {
+            start(id(name));
+        }
+
         /**
-         * @brief End timing for a named operation and record the duration
+         * @brief End timing for an operation started on the calling thread and record the duration
          * @param name Name of the timer to end
          * @return Duration in nanoseconds, or 0 if timer not found
          */
-        static Duration end(const std::string &name)
+        static Duration end(Id timer)
         {
             if constexpr (TIMER_ENABLED)
             {
                 auto endTime = Clock::now();
-                auto &startTimes = getStartTimes();
-                auto &stats = getStats();
-
-                auto it = startTimes.find(name);
-                if (it != startTimes.end())
+                auto &startTime = startTimes_[timer];
+                if (startTime != TimePoint{})
                 {
-                    auto elapsed = std::chrono::duration_cast<Duration>(endTime - it->second);
-                    stats[name].update(elapsed);
-                    startTimes.erase(it);
+                    auto elapsed = std::chrono::duration_cast<Duration>(endTime - startTime);
+                    startTime = TimePoint{};
+                    record(timer, elapsed);
                     return elapsed;
                 }
             }
             return Duration{0};
         }
 
+        static Duration end(const std::string &name)
+        {
+            return end(id(name));
+        }
+
+        /**
+         * @brief Add one measurement to a timer; lock-free and allocation-free
+         */
+        static void record(Id timer, Duration elapsed)
+        {
+            if constexpr (TIMER_ENABLED)
+            {
+                ThreadSlots &slots = localSlots();
+                const auto epoch = registry().epoch.load(std::memory_order_acquire);
+                if (slots.epoch.load(std::memory_order_relaxed) != epoch)
+                {
+                    // reset() was called since this thread last recorded
+                    slots.clear();
+                    slots.epoch.store(epoch, std::memory_order_release);
+                }
+
+                // Only this thread writes its slots, so plain load + store is enough
+                Slot &slot = slots.slots[timer];
+                const auto ns = static_cast<std::uint64_t>(std::max<Duration::rep>(elapsed.count(), 0));
+                slot.count.store(slot.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                slot.totalNs.store(slot.totalNs.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+                if (ns < slot.minNs.load(std::memory_order_relaxed))
+                    slot.minNs.store(ns, std::memory_order_relaxed);
+                if (ns > slot.maxNs.load(std::memory_order_relaxed))
+                    slot.maxNs.store(ns, std::memory_order_relaxed);
+            }
+        }
+
         /**
          * @brief Measure execution time of a function/lambda
          * @param name Timer name
@@ -134,7 +220,7 @@ namespace core
          * @return Duration in nanoseconds
          */
         template <typename Func>
-        static Duration measure(const std::string &name, Func &&func)
+        static Duration measure(Id timer, Func &&func)
         {
             if constexpr (TIMER_ENABLED)
             {
@@ -142,7 +228,7 @@ namespace core
                 func();
                 auto endTime = Clock::now();
                 auto elapsed = std::chrono::duration_cast<Duration>(endTime - startTime);
-                getStats()[name].update(elapsed);
+                record(timer, elapsed);
                 return elapsed;
             }
             else
@@ -152,20 +238,54 @@ namespace core
             }
         }
 
+        template <typename Func>
+        static Duration measure(const std::string &name, Func &&func)
+        {
+            return measure(id(name), std::forward<Func>(func));
+        }
+
         /**
-         * @brief Get statistics for a specific timer
+         * @brief Get statistics for a specific timer, merged over all threads
          * @param name Timer name
          * @return TimerStats object, or default if not found
          */
-        static TimerStats getTimerStats(const std::string &name)
+        static TimerStats getTimerStats(Id timer)
         {
+            TimerStats merged;
             if constexpr (TIMER_ENABLED)
             {
-                auto &stats = getStats();
-                auto it = stats.find(name);
-                return it != stats.end() ? it->second : TimerStats{};
+                auto &reg = registry();
+                const auto epoch = reg.epoch.load(std::memory_order_acquire);
+                for (const ThreadSlots *slots = reg.threads.load(std::memory_order_acquire); slots; slots = slots->next)
+                {
+                    // Slots not yet cleared after a reset() hold old data
+                    if (slots->epoch.load(std::memory_order_acquire) != epoch)
+                        continue;
+                    const Slot &slot = slots->slots[timer];
+                    const auto count = slot.count.load(std::memory_order_relaxed);
+                    if (count == 0)
+                        continue;
+                    merged.count += count;
+                    merged.total += Duration{static_cast<Duration::rep>(slot.totalNs.load(std::memory_order_relaxed))};
+                    merged.min = std::min(merged.min, Duration{static_cast<Duration::rep>(slot.minNs.load(std::memory_order_relaxed))});
+                    merged.max = std::max(merged.max, Duration{static_cast<Duration::rep>(slot.maxNs.load(std::memory_order_relaxed))});
+                }
             }
-            return TimerStats{};
+            return merged;
+        }
+
+        static TimerStats getTimerStats(const std::string &name)
+        {
+            Id timer = 0;
+            {
+                auto &reg = registry();
+                std::lock_guard<std::mutex> lock(reg.mutex);
+                auto it = reg.ids.find(name);
+                if (it == reg.ids.end())
+                    return TimerStats{};
+                timer = it->second;
+            }
+            return getTimerStats(timer);
         }
 
         /**
@@ -176,16 +296,26 @@ namespace core
         {
             if constexpr (TIMER_ENABLED)
             {
-                auto &stats = getStats();
-                if (stats.empty())
+                std::vector<std::string> names;
+                {
+                    auto &reg = registry();
+                    std::lock_guard<std::mutex> lock(reg.mutex);
+                    names = reg.names;
+                }
+
+                std::vector<std::pair<std::string, TimerStats>> sortedStats;
+                for (std::size_t i = 0; i < names.size(); ++i)
+                {
+                    auto stats = getTimerStats(static_cast<Id>(i));
+                    if (stats.count > 0)
+                        sortedStats.emplace_back(names[i], stats);
+                }
+                if (sortedStats.empty())
                 {
                     std::cout << "No timing data available\n";
                     return;
                 }
 
-                // Convert to vector for sorting
-                std::vector<std::pair<std::string, TimerStats>> sortedStats(stats.begin(), stats.end());
-
                 if (sortByTotal)
                 {
                     std::sort(sortedStats.begin(), sortedStats.end(),
@@ -229,49 +359,128 @@ namespace core
         }
 
         /**
-         * @brief Reset all timing data
+         * @brief Reset all timing data, on every thread
+         *
+         * Other threads clear their slots the next time they record; until then their old
+         * data is left out of reports.
          */
         static void reset()
         {
             if constexpr (TIMER_ENABLED)
             {
-                getStartTimes().clear();
-                getStats().clear();
+                registry().epoch.fetch_add(1, std::memory_order_acq_rel);
+                startTimes_.fill(TimePoint{});
             }
         }
 
         /**
-         * @brief Get total number of active timers
+         * @brief Get number of timers started and not yet ended on the calling thread
          */
         static size_t getActiveTimerCount()
         {
             if constexpr (TIMER_ENABLED)
             {
-                return getStartTimes().size();
+                return static_cast<size_t>(std::count_if(startTimes_.begin(), startTimes_.end(),
+                                                         [](const TimePoint &t)
+                                                         { return t != TimePoint{}; }));
             }
             return 0;
         }
 
-// Compile-time switch to enable/disable timing
-// Automatically disabled in Release builds (when NDEBUG is defined) for zero overhead
-#ifdef NDEBUG
-        static constexpr bool TIMER_ENABLED = false; // Release builds (NDEBUG defined)
-#else
-        static constexpr bool TIMER_ENABLED = true; // Debug builds
-#endif
+        // Compile-time switch to enable/disable timing (see ADSIL_TIMERS)
+        static constexpr bool TIMER_ENABLED = ADSIL_TIMERS != 0;
+
+    private:
+        // One timer on one thread; written by the owning thread only, read by reports
+        struct Slot
+        {
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::uint64_t> totalNs{0};
+            std::atomic<std::uint64_t> minNs{std::numeric_limits<std::uint64_t>::max()};
+            std::atomic<std::uint64_t> maxNs{0};
+        };
+
+        // All slots of one thread; kept after the thread exits and reused by a later one
+        struct ThreadSlots
+        {
+            std::array<Slot, MAX_TIMERS> slots;
+            std::atomic<std::uint64_t> epoch{0};
+            std::atomic<bool> inUse{true};
+            ThreadSlots *next = nullptr;
+
+            void clear()
+            {
+                for (auto &slot : slots)
+                {
+                    slot.count.store(0, std::memory_order_relaxed);
+                    slot.totalNs.store(0, std::memory_order_relaxed);
+                    slot.minNs.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+                    slot.maxNs.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        struct Registry
+        {
+            std::mutex mutex; // guards the names only
+            std::unordered_map<std::string, Id> ids;
+            std::vector<std::string> names;
+            std::atomic<ThreadSlots *> threads{nullptr}; // push-only list
+            std::atomic<std::uint64_t> epoch{0};
+        };
+
+        static Registry &registry()
+        {
+            // Never destroyed: threads may still record while statics are torn down
+            static Registry *instance = new Registry;
+            return *instance;
+        }
+
+        // Hands the slots back when the thread exits
+        struct SlotsRelease
+        {
+            ~SlotsRelease()
+            {
+                if (currentSlots_)
+                {
+                    currentSlots_->inUse.store(false, std::memory_order_release);
+                    currentSlots_ = nullptr;
+                }
+            }
+        };
 
-        // Thread-local storage for better performance in multi-threaded scenarios
-        static std::unordered_map<std::string, TimePoint> &getStartTimes()
+        static ThreadSlots &localSlots()
         {
-            static thread_local std::unordered_map<std::string, TimePoint> startTimes;
-            return startTimes;
+            if (currentSlots_ == nullptr)
+            {
+                currentSlots_ = &claimSlots();
+                thread_local SlotsRelease release;
+                (void)release;
+            }
+            return *currentSlots_;
         }
 
-        static std::unordered_map<std::string, TimerStats> &getStats()
+        static ThreadSlots &claimSlots()
         {
-            static thread_local std::unordered_map<std::string, TimerStats> stats;
-            return stats;
+            auto &reg = registry();
+            for (ThreadSlots *slots = reg.threads.load(std::memory_order_acquire); slots; slots = slots->next)
+            {
+                bool expected = false;
+                if (slots->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                    return *slots;
+            }
+
+            auto *slots = new ThreadSlots;
+            slots->epoch.store(reg.epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+            slots->next = reg.threads.load(std::memory_order_relaxed);
+            while (!reg.threads.compare_exchange_weak(slots->next, slots, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+            return *slots;
         }
+
+        inline static thread_local ThreadSlots *currentSlots_ = nullptr;
+        inline static thread_local std::array<TimePoint, MAX_TIMERS> startTimes_{};
     };
 
     /**
@@ -283,12 +492,17 @@ namespace core
     class ScopedTimer
     {
     public:
-        explicit ScopedTimer(const std::string &name)
-            : name_(name), startTime_(Timer::Clock::now()), done_(false)
+        explicit ScopedTimer(Timer::Id timer)
+            : timer_(timer), startTime_(Timer::TIMER_ENABLED ? Timer::Clock::now() : Timer::TimePoint{}), done_(false)
         {
             // No need to call Timer::start() - we handle timing directly for better performance
         }
 
+        explicit ScopedTimer(const std::string &name)
+            : ScopedTimer(Timer::id(name))
+        {
+        }
+
         ~ScopedTimer()
         {
             if (!done_)
@@ -297,11 +511,24 @@ namespace core
             }
         }
 
-        // Non-copyable, movable
+        // Non-copyable, movable; a moved-from timer records nothing
         ScopedTimer(const ScopedTimer &) = delete;
         ScopedTimer &operator=(const ScopedTimer &) = delete;
-        ScopedTimer(ScopedTimer &&) = default;
-        ScopedTimer &operator=(ScopedTimer &&) = default;
+        ScopedTimer(ScopedTimer &&other) noexcept
+            : timer_(other.timer_), startTime_(other.startTime_), done_(std::exchange(other.done_, true))
+        {
+        }
+        ScopedTimer &operator=(ScopedTimer &&other) noexcept
+        {
+            if (this != &other)
+            {
+                end();
+                timer_ = other.timer_;
+                startTime_ = other.startTime_;
+                done_ = std::exchange(other.done_, true);
+            }
+            return *this;
+        }
 
         /**
          * @brief Manually end the timer (useful for TIMER_BLOCK macro)
@@ -314,7 +541,7 @@ namespace core
                 {
                     auto endTime = Timer::Clock::now();
                     auto elapsed = std::chrono::duration_cast<Timer::Duration>(endTime - startTime_);
-                    Timer::getStats()[name_].update(elapsed);
+                    Timer::record(timer_, elapsed);
                     done_ = true;
                     return elapsed;
                 }
@@ -328,12 +555,16 @@ namespace core
         bool isDone() const { return done_; }
 
         /**
-         * @brief Mark timer as done (for TIMER_BLOCK macro)
+         * @brief Record the block and mark the timer as done (for TIMER_BLOCK macro)
          */
-        void markDone() { done_ = true; }
+        void markDone()
+        {
+            end();
+            done_ = true;
+        }
 
     private:
-        std::string name_;
+        Timer::Id timer_;
         Timer::TimePoint startTime_;
         bool done_;
     };
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Alias.hpp"
+#include "FrameArena.hpp"
 #include "Logger.hpp"
 #include "ResourceLocator.hpp"
-#include "Timer.hpp"
\ No newline at end of file
+#include "Timer.hpp"
+#include "ThreadPool.hpp"
\ No newline at end of file
@@ -0,0 +1,279 @@
+#include <core/Logger.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+namespace
+{
+    std::string logPath(const std::string &name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    std::vector<std::string> readLines(const std::string &path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    // Text after the "[LEVEL] " prefix
+    std::string messageOf(const std::string &line)
+    {
+        const auto end = line.find("] ", line.find("] ") + 2);
+        return end == std::string::npos ? line : line.substr(end + 2);
+    }
+
+    core::Logger &fileLogger(const std::string &name, const std::string &path)
+    {
+        std::filesystem::remove(path);
+        auto &logger = core::Logger::getInstance(name);
+        logger.setLevel(core::Logger::Level::TRACE);
+        logger.setLogFile(path);
+        return logger;
+    }
+}
+
+void test_asyncKeepsEveryLineInThreadOrder()
+{
+    std::cout << "\n=== Testing asynchronous logging from several threads ===" << std::endl;
+
+    const auto path = logPath("async_logger_order.log");
+    fileLogger("async_order", path);
+    core::Logger::startAsync();
+    assert_true(core::Logger::isAsync(), "Asynchronous mode is on after startAsync");
+
+    constexpr int threads = 4;
+    constexpr int perThread = 2000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([t]
+                             {
+            for (int i = 0; i < perThread; ++i)
+            {
+                core::Logger::getInstance("async_order").logFormat(core::Logger::Level::INFO, "worker {} line {}", __FILE__, __LINE__, __func__, t, i);
+            } });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    core::Logger::stopAsync();
+    assert_true(!core::Logger::isAsync(), "stopAsync returns to synchronous logging");
+
+    const auto lines = readLines(path);
+    std::vector<int> next(threads, 0);
+    bool ordered = true;
+    for (const auto &line : lines)
+    {
+        const auto message = messageOf(line);
+        int worker = -1;
+        int index = -1;
+        if (std::sscanf(message.c_str(), "worker %d line %d", &worker, &index) == 2 && worker >= 0 && worker < threads)
+        {
+            ordered = ordered && next[static_cast<std::size_t>(worker)] == index;
+            next[static_cast<std::size_t>(worker)]++;
+        }
+    }
+    assert_true(lines.size() == threads * perThread, "stopAsync writes every queued line");
+    assert_true(ordered, "Lines of one thread keep their order");
+
+    const auto stats = core::Logger::getAsyncStats();
+    assert_true(stats.dropped == 0 && stats.written >= threads * perThread, "Block policy loses nothing");
+}
+
+void test_deferredFormatMatchesSynchronous()
+{
+    std::cout << "\n=== Testing deferred formatting ===" << std::endl;
+
+    const auto path = logPath("async_logger_format.log");
+    auto &logger = fileLogger("async_format", path);
+    const std::string name = "tx_front";
+    const std::string longText(600, 'x');
+
+    using Level = core::Logger::Level;
+    const auto logAll = [&]
+    {
+        logger.logFormat(Level::INFO, "point {} at {} m, valid={}", __FILE__, __LINE__, __func__, name, 2.5, true);
+        logger.logFormat(Level::WARN, "{} and {} but no third {}", __FILE__, __LINE__, __func__, 1, 'c');
+        LOGGER_INFO_F("async_format", "extra args ignored", 42);
+        LOGGER_INFO_F("async_format", "long {}", longText);
+        LOGGER_INFO("async_format", "plain " + longText);
+    };
+
+    logAll();
+    core::Logger::startAsync();
+    logAll();
+    core::Logger::stopAsync();
+
+    const auto lines = readLines(path);
+    assert_true(lines.size() == 10, "Both passes are logged");
+    bool same = true;
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        same = same && messageOf(lines[i]) == messageOf(lines[i + 5]);
+    }
+    assert_true(same, "Deferred formatting gives the synchronous text");
+    assert_true(messageOf(lines[5]) == "point tx_front at 2.500000 m, valid=1", "Placeholders are filled in order");
+}
+
+void test_dropPolicyCountsOverflow()
+{
+    std::cout << "\n=== Testing the drop overflow policy ===" << std::endl;
+
+    const auto path = logPath("async_logger_drop.log");
+    fileLogger("async_drop", path);
+
+    core::AsyncLogOptions options;
+    options.ringCapacity = 8;
+    options.overflow = core::LogOverflowPolicy::Drop;
+    options.maxLatency = std::chrono::milliseconds(500);
+    core::Logger::startAsync(options);
+
+    // A new thread gets a ring of the new capacity
+    constexpr int calls = 1000;
+    std::thread([]
+                {
+        for (int i = 0; i < calls; ++i)
+        {
+            LOGGER_DEBUG_F("async_drop", "burst {}", i);
+        } })
+        .join();
+    core::Logger::stopAsync();
+    const auto stats = core::Logger::getAsyncStats();
+
+    assert_true(stats.dropped > 0, "A full ring drops records instead of blocking");
+    assert_true(readLines(path).size() + stats.dropped == calls, "Every call is either written or counted as dropped");
+}
+
+void test_errorsAreWrittenWithoutWaiting()
+{
+    std::cout << "\n=== Testing write latency ===" << std::endl;
+
+    const auto path = logPath("async_logger_latency.log");
+    fileLogger("async_latency", path);
+
+    core::AsyncLogOptions options;
+    options.maxLatency = std::chrono::milliseconds(300);
+    core::Logger::startAsync(options);
+
+    const auto waitForLines = [&path](std::size_t count)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (readLines(path).size() < count && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    LOGGER_INFO("async_latency", "routine");
+    const double infoMs = waitForLines(1);
+    LOGGER_ERROR("async_latency", "failure");
+    const double errorMs = waitForLines(2);
+    core::Logger::stopAsync();
+
+    std::cout << "  INFO on disk after " << infoMs << " ms, ERROR after " << errorMs << " ms" << std::endl;
+    assert_true(infoMs < 2000.0, "INFO reaches the file within the configured latency");
+    assert_true(errorMs < 150.0 && readLines(path).size() == 2, "ERROR reaches the file without waiting for the interval");
+}
+
+void test_stopWhileProducersBlock()
+{
+    std::cout << "\n=== Testing stop while producers wait for ring space ===" << std::endl;
+
+    const auto path = logPath("async_logger_stop.log");
+    fileLogger("async_stop", path);
+
+    core::AsyncLogOptions options;
+    options.ringCapacity = 2; // tiny rings keep the producers blocked most of the time
+    options.overflow = core::LogOverflowPolicy::Block;
+    core::Logger::startAsync(options);
+
+    // A hang here is the failure; report it instead of stalling the suite
+    std::atomic<bool> finished{false};
+    std::thread watchdog([&finished]
+                         {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        while (!finished.load())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                std::cerr << "ASSERTION FAILED: stopAsync deadlocked with blocked producers" << std::endl;
+                std::_Exit(1);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        } });
+
+    constexpr int threads = 4;
+    std::atomic<bool> logging{true};
+    std::atomic<int> calls{0};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < threads; ++t)
+    {
+        producers.emplace_back([&]
+                               {
+            while (logging.load())
+            {
+                LOGGER_DEBUG_F("async_stop", "tick {}", calls.fetch_add(1));
+            } });
+    }
+
+    constexpr int restarts = 300;
+    for (int i = 0; i < restarts; ++i)
+    {
+        std::this_thread::yield();
+        core::Logger::stopAsync();
+        core::Logger::startAsync(options);
+    }
+    logging = false;
+    for (auto &producer : producers)
+    {
+        producer.join();
+    }
+    core::Logger::stopAsync();
+    finished = true;
+    watchdog.join();
+
+    assert_true(true, "stopAsync returns while producers are blocked on full rings");
+    assert_true(readLines(path).size() == static_cast<std::size_t>(calls.load()), "No record is lost across restarts");
+}
+
+int main()
+{
+    std::cout << "🪵 Starting AsyncLogger Tests" << std::endl;
+    std::cout << "=============================" << std::endl;
+
+    test_asyncKeepsEveryLineInThreadOrder();
+    test_deferredFormatMatchesSynchronous();
+    test_dropPolicyCountsOverflow();
+    test_errorsAreWrittenWithoutWaiting();
+    test_stopWhileProducersBlock();
+
+    std::cout << "\n🎉 All AsyncLogger tests passed!" << std::endl;
+    return 0;
+}
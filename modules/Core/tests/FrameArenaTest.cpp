@@ -0,0 +1,90 @@
+#include <core/FrameArena.hpp>
+
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+void test_allocationsAreCounted()
+{
+    std::cout << "\n=== Testing allocation counters ===" << std::endl;
+
+    core::FrameArena arena(4096);
+    {
+        std::pmr::vector<int> values(arena.resource());
+        values.reserve(100);
+        std::pmr::vector<float> more(50, 1.0f, arena.resource());
+    }
+
+    const auto stats = arena.getStats();
+    assert_true(stats.allocations == 2, "Two container buffers were allocated from the arena");
+    assert_true(stats.bytes == 100 * sizeof(int) + 50 * sizeof(float), "Requested bytes are summed");
+    assert_true(stats.overflowBuffers == 0, "Small frame fits in the arena buffer");
+
+    arena.reset();
+    assert_true(arena.getStats().allocations == 0, "reset() clears the counters");
+}
+
+void test_overflowGrowsBuffer()
+{
+    std::cout << "\n=== Testing overflow and growth ===" << std::endl;
+
+    core::FrameArena arena(1024);
+    const auto frame = [&arena]
+    {
+        std::pmr::vector<double> big(4096, 0.0, arena.resource());
+        std::pmr::vector<char> flags(512, 0, arena.resource());
+        return big.size() + flags.size();
+    };
+
+    (void)frame();
+    assert_true(arena.getStats().overflowBuffers > 0, "Frame larger than the buffer overflows to the heap");
+
+    arena.reset();
+    assert_true(arena.getStats().capacity > 1024, "reset() grows the buffer by the overflow");
+
+    (void)frame();
+    assert_true(arena.getStats().overflowBuffers == 0, "Same-sized frame fits after growing");
+}
+
+void test_memoryIsReusedAcrossFrames()
+{
+    std::cout << "\n=== Testing reuse across frames ===" << std::endl;
+
+    core::FrameArena arena(8192);
+    void *first = nullptr;
+    for (int round = 0; round < 3; ++round)
+    {
+        arena.reset();
+        std::pmr::vector<int> values(256, round, arena.resource());
+        if (round == 0)
+        {
+            first = values.data();
+        }
+        assert_true(values.data() == first, "Round " + std::to_string(round) + " gets the same buffer");
+    }
+}
+
+int main()
+{
+    std::cout << "🧱 Starting FrameArena Tests" << std::endl;
+    std::cout << "============================" << std::endl;
+
+    test_allocationsAreCounted();
+    test_overflowGrowsBuffer();
+    test_memoryIsReusedAcrossFrames();
+
+    std::cout << "\n🎉 All FrameArena tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,186 @@
+// Compile this file as if configured with ADSIL_LOG_MIN_LEVEL=WARN to test compile-time removal
+#undef ADSIL_LOG_MIN_LEVEL
+#define ADSIL_LOG_MIN_LEVEL 3
+
+#include <core/Logger.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+namespace
+{
+    int evaluations = 0;
+
+    std::string counted(const std::string &text)
+    {
+        ++evaluations;
+        return text;
+    }
+
+    std::size_t lineCount(const std::string &path)
+    {
+        std::ifstream file(path);
+        std::size_t lines = 0;
+        std::string line;
+        while (std::getline(file, line))
+        {
+            ++lines;
+        }
+        return lines;
+    }
+
+    core::Logger &fileLogger(const std::string &name, std::string &path)
+    {
+        path = (std::filesystem::temp_directory_path() / ("adsil_filter_" + name + ".log")).string();
+        std::filesystem::remove(path);
+        auto &logger = core::Logger::getInstance(name);
+        logger.setLevel(core::Logger::Level::TRACE);
+        logger.setLogFile(path);
+        return logger;
+    }
+}
+
+void test_compiledOutStatementsSkipArguments()
+{
+    std::string path;
+    fileLogger("compiled", path);
+    evaluations = 0;
+
+    LOGGER_INFO("compiled", counted("removed at compile time"));
+    LOGGER_DEBUG_F("compiled", "removed {}", counted("too"));
+    LOGGER_INFO_EVERY_N(1, "compiled", counted("sampled, still removed"));
+    assert_true(evaluations == 0, "Statements below ADSIL_LOG_MIN_LEVEL do not evaluate their arguments");
+
+    LOGGER_WARN("compiled", counted("kept"));
+    assert_true(evaluations == 1 && lineCount(path) == 1, "Statements at ADSIL_LOG_MIN_LEVEL are still written");
+    std::filesystem::remove(path);
+}
+
+void test_disabledLevelSkipsArguments()
+{
+    std::string path;
+    auto &logger = fileLogger("runtime", path);
+    logger.setLevel(core::Logger::Level::ERROR);
+    evaluations = 0;
+
+    LOGGER_WARN("runtime", counted("filtered at run time"));
+    LOGGER_WARN_F("runtime", "filtered {}", counted("too"));
+    assert_true(evaluations == 0 && lineCount(path) == 0, "Statements below the logger level do not evaluate their arguments");
+
+    LOGGER_ERROR("runtime", counted("written"));
+    assert_true(evaluations == 1 && lineCount(path) == 1, "Statements at the logger level are written");
+    std::filesystem::remove(path);
+}
+
+void test_lowestLevelTracksAllLoggers()
+{
+    std::string path;
+    fileLogger("lowest", path);
+    // New loggers start at ERROR, so only the live ones decide what gets through
+    setenv("ADSIL_LOG_LEVEL", "ERROR", 1);
+    core::Logger::getInstance().setLevel(core::Logger::Level::ERROR);
+    core::Logger::getInstance("compiled").setLevel(core::Logger::Level::ERROR);
+    core::Logger::getInstance("runtime").setLevel(core::Logger::Level::ERROR);
+    core::Logger::getInstance("lowest").setLevel(core::Logger::Level::WARN);
+
+    assert_true(core::Logger::anyLoggerEnabled(core::Logger::Level::WARN), "WARN is enabled while one logger accepts it");
+    assert_true(!core::Logger::anyLoggerEnabled(core::Logger::Level::INFO), "INFO is rejected when no logger accepts it");
+
+    core::Logger::getInstance("lowest").setLevel(core::Logger::Level::ERROR);
+    assert_true(!core::Logger::anyLoggerEnabled(core::Logger::Level::WARN), "Raising the last WARN logger raises the lowest level");
+
+    core::Logger::getInstance("late").setLevel(core::Logger::Level::TRACE);
+    assert_true(core::Logger::anyLoggerEnabled(core::Logger::Level::WARN), "A logger lowered to TRACE lowers it again");
+    core::Logger::getInstance("late").setLevel(core::Logger::Level::ERROR);
+
+    // Without ADSIL_LOG_LEVEL a channel's first logger starts at TRACE, so its first message
+    // must get past the check even though every live logger is at ERROR
+    unsetenv("ADSIL_LOG_LEVEL");
+    core::Logger::getInstance("late").setLevel(core::Logger::Level::ERROR);
+    assert_true(core::Logger::anyLoggerEnabled(core::Logger::Level::WARN), "Loggers not created yet keep WARN enabled");
+    evaluations = 0;
+    LOGGER_WARN("unborn", counted("first message of a new channel"));
+    assert_true(evaluations == 1, "A channel created after every logger was raised still logs");
+    std::filesystem::remove(path);
+}
+
+void test_everyNLogsOneCallInN()
+{
+    std::string path;
+    fileLogger("sampled", path);
+    for (int i = 0; i < 10; ++i)
+    {
+        LOGGER_WARN_EVERY_N(4, "sampled", "call " + std::to_string(i));
+    }
+    assert_true(lineCount(path) == 3, "EVERY_N(4) over 10 calls logs calls 1, 5 and 9");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([]
+                             {
+                                 for (int i = 0; i < 1000; ++i)
+                                 {
+                                     LOGGER_ERROR_EVERY_N(100, "sampled", "threaded call");
+                                 } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    assert_true(lineCount(path) == 3 + 40, "The count is shared by all threads at a call site");
+    std::filesystem::remove(path);
+}
+
+void test_everyMsLimitsRate()
+{
+    std::string path;
+    fileLogger("limited", path);
+    for (int i = 0; i < 100; ++i)
+    {
+        LOGGER_WARN_EVERY_MS(60000, "limited", "burst " + std::to_string(i));
+    }
+    assert_true(lineCount(path) == 1, "EVERY_MS logs the first call of a burst only");
+
+    const auto logTwice = []
+    {
+        LOGGER_WARN_EVERY_MS(20, "limited", "periodic");
+    };
+    logTwice();
+    logTwice();
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    logTwice();
+    assert_true(lineCount(path) == 3, "EVERY_MS logs again once the period has passed");
+    std::filesystem::remove(path);
+}
+
+int main()
+{
+    std::cout << "🔇 Starting Logger Filter Tests" << std::endl;
+    std::cout << "===============================" << std::endl;
+
+    test_compiledOutStatementsSkipArguments();
+    test_disabledLevelSkipsArguments();
+    test_lowestLevelTracksAllLoggers();
+    test_everyNLogsOneCallInN();
+    test_everyMsLimitsRate();
+
+    std::cout << "\n🎉 All Logger Filter tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <core/MpscQueue.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+void test_fifoAndCapacity()
+{
+    std::cout << "\n=== Testing order and capacity ===" << std::endl;
+
+    core::MpscQueue<int> queue(5);
+    assert_true(queue.capacity() == 8, "Capacity is rounded up to a power of two");
+
+    int value = 0;
+    assert_true(!queue.tryPop(value), "Empty queue pops nothing");
+
+    bool pushedAll = true;
+    for (int i = 0; i < 8; ++i)
+    {
+        pushedAll = pushedAll && queue.tryPush(i);
+    }
+    assert_true(pushedAll, "Queue accepts capacity() values");
+    assert_true(!queue.tryPush(99), "Full queue rejects a push");
+    assert_true(queue.sizeApprox() == 8, "Size counts queued values");
+
+    bool inOrder = true;
+    for (int i = 0; i < 8; ++i)
+    {
+        inOrder = inOrder && queue.tryPop(value) && value == i;
+    }
+    assert_true(inOrder, "Values come out in push order");
+    assert_true(queue.sizeApprox() == 0, "Size drops back to zero");
+
+    // Wrap around the ring several times
+    bool wrapped = true;
+    for (int i = 0; i < 100; ++i)
+    {
+        wrapped = wrapped && queue.tryPush(i) && queue.tryPop(value) && value == i;
+    }
+    assert_true(wrapped, "Slots are reused after wrap-around");
+}
+
+void test_manyProducersOneConsumer()
+{
+    std::cout << "\n=== Testing concurrent producers ===" << std::endl;
+
+    constexpr int producers = 4;
+    constexpr int perProducer = 20000;
+    core::MpscQueue<int> queue(256);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&queue, p]
+                             {
+            for (int i = 0; i < perProducer; ++i)
+            {
+                while (!queue.tryPush(p * perProducer + i))
+                {
+                    std::this_thread::yield();
+                }
+            } });
+    }
+
+    // Each producer's values must arrive in its own order, and all of them exactly once
+    std::vector<int> next(producers, 0);
+    bool ordered = true;
+    int received = 0;
+    while (received < producers * perProducer)
+    {
+        int value = 0;
+        if (!queue.tryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const int producer = value / perProducer;
+        ordered = ordered && value % perProducer == next[static_cast<std::size_t>(producer)];
+        next[static_cast<std::size_t>(producer)]++;
+        ++received;
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    int dummy = 0;
+    assert_true(ordered, "Per-producer order is preserved");
+    assert_true(received == producers * perProducer && !queue.tryPop(dummy), "Every value is received exactly once");
+}
+
+int main()
+{
+    std::cout << "📬 Starting MpscQueue Tests" << std::endl;
+    std::cout << "===========================" << std::endl;
+
+    test_fifoAndCapacity();
+    test_manyProducersOneConsumer();
+
+    std::cout << "\n🎉 All MpscQueue tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <core/ThreadPool.hpp>
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+void test_parallelForVisitsEveryIndexOnce()
+{
+    std::cout << "\n=== Testing parallelFor coverage ===" << std::endl;
+
+    core::ThreadPool pool(3);
+    assert_true(pool.getWorkerCount() == 3, "Pool starts the requested number of workers");
+
+    for (std::size_t count : {0U, 1U, 7U, 10000U})
+    {
+        std::vector<std::atomic<int>> hits(count);
+        pool.parallelFor(count, [&hits](std::size_t i)
+                         { hits[i].fetch_add(1); });
+
+        bool once = true;
+        for (const auto &hit : hits)
+        {
+            once = once && hit.load() == 1;
+        }
+        assert_true(once, "Each of " + std::to_string(count) + " indices runs exactly once");
+    }
+}
+
+void test_resultsAreIndexAddressed()
+{
+    std::cout << "\n=== Testing deterministic index-addressed output ===" << std::endl;
+
+    core::ThreadPool pool(4);
+    std::vector<std::size_t> squares(1000, 0);
+    // Reuse the same workers for several rounds
+    for (int round = 0; round < 5; ++round)
+    {
+        pool.parallelFor(squares.size(), [&squares](std::size_t i)
+                         { squares[i] = i * i; });
+    }
+
+    bool correct = true;
+    for (std::size_t i = 0; i < squares.size(); ++i)
+    {
+        correct = correct && squares[i] == i * i;
+    }
+    assert_true(correct, "Slots written by workers hold the expected values");
+}
+
+void test_exceptionsPropagate()
+{
+    std::cout << "\n=== Testing exception propagation ===" << std::endl;
+
+    core::ThreadPool pool(2);
+    std::atomic<int> ran{0};
+    bool threw = false;
+    try
+    {
+        pool.parallelFor(100, [&ran](std::size_t i)
+                         {
+            ran.fetch_add(1);
+            if (i == 42)
+            {
+                throw std::runtime_error("boom");
+            } });
+    }
+    catch (const std::runtime_error &e)
+    {
+        threw = std::string(e.what()) == "boom";
+    }
+    assert_true(threw, "First task exception is rethrown to the caller");
+    assert_true(ran.load() == 100, "Remaining indices still run after an exception");
+
+    auto future = pool.submit([] {});
+    future.get();
+    assert_true(true, "Pool keeps accepting work after an exception");
+}
+
+int main()
+{
+    std::cout << "🧵 Starting ThreadPool Tests" << std::endl;
+    std::cout << "============================" << std::endl;
+
+    test_parallelForVisitsEveryIndexOnce();
+    test_resultsAreIndexAddressed();
+    test_exceptionsPropagate();
+
+    std::cout << "\n🎉 All ThreadPool tests passed!" << std::endl;
+    return 0;
+}
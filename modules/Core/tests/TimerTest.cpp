@@ -0,0 +1,168 @@
+// Timers are compiled out under NDEBUG; keep them on so Release test runs exercise them too
+#undef ADSIL_TIMERS
+#define ADSIL_TIMERS 1
+
+#include <core/Timer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+void test_namesAreInterned()
+{
+    const auto a = core::Timer::id("intern_a");
+    const auto b = core::Timer::id("intern_b");
+    assert_true(a != b, "Different names get different ids");
+    assert_true(core::Timer::id("intern_a") == a, "The same name always gets the same id");
+}
+
+void test_scopesOnOtherThreadsAreMerged()
+{
+    core::Timer::reset();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([]
+                             {
+                                 for (int i = 0; i < 1000; ++i)
+                                 {
+                                     TIMER_SCOPE("merge_scope");
+                                 } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    auto stats = core::Timer::getTimerStats("merge_scope");
+    assert_true(stats.count == 4000, "Measurements from all threads are merged, including finished ones");
+    assert_true(stats.min <= stats.max && stats.total >= stats.max, "Merged min, max and total are consistent");
+
+    // A new thread reuses the slots of a finished one; the totals keep adding up
+    std::thread([]
+                { TIMER_SCOPE("merge_scope"); })
+        .join();
+    assert_true(core::Timer::getTimerStats("merge_scope").count == 4001, "Reused slots keep earlier measurements");
+}
+
+void test_minAndMaxAreTracked()
+{
+    core::Timer::reset();
+    const auto timer = core::Timer::id("min_max");
+    core::Timer::record(timer, std::chrono::milliseconds(5));
+    core::Timer::record(timer, std::chrono::milliseconds(1));
+    std::thread([timer]
+                { core::Timer::record(timer, std::chrono::milliseconds(9)); })
+        .join();
+
+    auto stats = core::Timer::getTimerStats(timer);
+    assert_true(stats.count == 3 && stats.total == std::chrono::milliseconds(15), "Count and total cover all threads");
+    assert_true(stats.min == std::chrono::milliseconds(1) && stats.max == std::chrono::milliseconds(9), "Min and max cover all threads");
+}
+
+void test_resetClearsEveryThread()
+{
+    std::atomic<bool> recorded{false};
+    std::atomic<bool> resetDone{false};
+    std::thread worker([&]
+                       {
+                           core::Timer::measure("reset_worker", [] {});
+                           recorded.store(true);
+                           while (!resetDone.load())
+                           {
+                               std::this_thread::yield();
+                           }
+                           core::Timer::measure("reset_worker", [] {}); });
+
+    while (!recorded.load())
+    {
+        std::this_thread::yield();
+    }
+    assert_true(core::Timer::getTimerStats("reset_worker").count == 1, "Worker measurement is visible before reset");
+    core::Timer::reset();
+    assert_true(core::Timer::getTimerStats("reset_worker").count == 0, "Reset hides another thread's data at once");
+    resetDone.store(true);
+    worker.join();
+    assert_true(core::Timer::getTimerStats("reset_worker").count == 1, "Measurements after reset start from zero");
+}
+
+void test_manualAndBlockTimers()
+{
+    core::Timer::reset();
+    TIMER_START("manual");
+    assert_true(core::Timer::getActiveTimerCount() == 1, "Started timer is active");
+    const auto elapsed = TIMER_END("manual");
+    assert_true(core::Timer::getActiveTimerCount() == 0 && elapsed.count() >= 0, "Ended timer is no longer active");
+    assert_true(core::Timer::end("manual").count() == 0, "Ending a timer that is not running records nothing");
+
+    TIMER_BLOCK("block")
+    {
+        TIMER_MEASURE("measure", std::this_thread::yield());
+    }
+    assert_true(core::Timer::getTimerStats("manual").count == 1, "TIMER_START/TIMER_END record once");
+    assert_true(core::Timer::getTimerStats("block").count == 1, "TIMER_BLOCK records its block");
+    assert_true(core::Timer::getTimerStats("measure").count == 1, "TIMER_MEASURE records its code");
+}
+
+void test_reportingWhileRecording()
+{
+    core::Timer::reset();
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 2; ++t)
+    {
+        writers.emplace_back([&]
+                             {
+                                 while (!stop.load(std::memory_order_relaxed))
+                                 {
+                                     TIMER_SCOPE("concurrent");
+                                 } });
+    }
+
+    std::uint64_t last = 0;
+    bool monotonic = true;
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto count = core::Timer::getTimerStats("concurrent").count;
+        monotonic = monotonic && count >= last;
+        last = count;
+        std::this_thread::yield();
+    }
+    stop.store(true);
+    for (auto &writer : writers)
+    {
+        writer.join();
+    }
+    assert_true(monotonic, "Counts read while other threads record never go backwards");
+    assert_true(core::Timer::getTimerStats("concurrent").count >= last, "Final count includes every read snapshot");
+}
+
+int main()
+{
+    std::cout << "⏱️ Starting Timer Tests" << std::endl;
+    std::cout << "======================" << std::endl;
+
+    test_namesAreInterned();
+    test_scopesOnOtherThreadsAreMerged();
+    test_minAndMaxAreTracked();
+    test_resetClearsEveryThread();
+    test_manualAndBlockTimers();
+    test_reportingWhileRecording();
+
+    std::cout << "\n🎉 All Timer tests passed!" << std::endl;
+    return 0;
+}
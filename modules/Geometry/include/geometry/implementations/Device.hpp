@@ -7,11 +7,22 @@
 #include <geometry/configs/DeviceConfig.hpp>
 #include <spatial/implementations/HasTransform.hpp>
 #include <math/math.hpp>
+#include <geometry/implementations/DeviceFrustum.hpp>
+#include <cstdint>
+#include <mutex>
+
 class Device : public spatial::HasTransform
 {
 public:
     Device(const DeviceConfig &config);
 
+    // FOV pyramid at the device's current pose. The frustum is cached and only rebuilt
+    // after the device's TransformNode changes pose or the FOV/range parameters change.
+    // Call it on the thread that owns the scene graph, since reading the pose refreshes
+    // TransformNode's lazy state; the returned frustum is immutable and may be handed to
+    // other threads (see ISolver::prepare).
+    std::shared_ptr<const DeviceFrustum> getFrustum() const;
+
     std::shared_ptr<math::PointCloud> pointsInFov(const math::PointCloud &pcd) const;
 
     std::string toString() const;
@@ -38,4 +49,22 @@ private:
     float horizontal_fov_rad_;
     float range_;
     std::string name_;
+
+    // Cached frustum keyed on the node and its pose version, guarded by its own mutex.
+    // The node is held weakly so a freed node whose address is reused never matches.
+    // A copied device starts with an empty cache.
+    struct FrustumCache
+    {
+        FrustumCache() = default;
+        FrustumCache(const FrustumCache &) {}
+        FrustumCache &operator=(const FrustumCache &other);
+
+        std::mutex mutex;
+        std::shared_ptr<const DeviceFrustum> frustum;
+        std::weak_ptr<const spatial::TransformNode> node;
+        std::uint64_t poseVersion = 0;
+    };
+    mutable FrustumCache frustumCache_;
+
+    void invalidateFrustum();
 };
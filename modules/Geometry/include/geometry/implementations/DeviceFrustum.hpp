@@ -0,0 +1,84 @@
+#pragma once
+
+#include <math/Point.hpp>
+#include <math/Vector.hpp>
+#include <math/PointCloudSoA.hpp>
+#include <math/Aabb.hpp>
+#include <spatial/implementations/Transform.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class DeviceFrustum
+ * @brief Immutable FOV pyramid of a device at one pose.
+ *
+ * The pyramid is described by its apex (the device origin), the four inward-facing
+ * side-plane normals and the range. A point is inside when it is within range and
+ * strictly on the inner side of all four planes, so a containment test costs one
+ * squared distance and four dot products.
+ *
+ * The far corners are kept in world space for consumers that draw the pyramid.
+ *
+ * Batch culling over a PointCloudSoA runs 8 (AVX2) or 4 (SSE) points per step, chosen
+ * at runtime from the host CPU, with a scalar fallback. Every backend evaluates the same
+ * float expressions in the same order as contains(), so results are bit-identical.
+ *
+ * @note Thread Safety: Instances are immutable after construction and can be shared
+ *       between threads freely.
+ */
+class DeviceFrustum
+{
+public:
+    // Corner order: (-w, +h), (+w, +h), (+w, -h), (-w, -h) in the device's local (y, z) frame.
+    static constexpr std::size_t CORNER_COUNT = 4;
+
+    DeviceFrustum(const spatial::Transform &globalTransform,
+                  float horizontalFovRad,
+                  float verticalFovRad,
+                  float range);
+
+    enum class CullBackend
+    {
+        Scalar,
+        SSE,
+        AVX2
+    };
+
+    [[nodiscard]] bool contains(const math::Point &point) const;
+
+    // Conservative box test for spatial-index traversal: false only when no point of the box
+    // can pass contains(). Lets DeviceFrustum be used as a math::PointKdTree query volume.
+    [[nodiscard]] bool intersects(const math::Aabb &box) const;
+
+    // Writes one bit per point: bit (i % 8) of bits[i / 8] is set when point i is inside.
+    // bits is resized to (points.size() + 7) / 8 bytes; unused high bits of the last byte are 0.
+    void cullMask(const math::PointCloudSoA &points, std::vector<std::uint8_t> &bits) const;
+    void cullMask(const math::PointCloudSoA &points, std::vector<std::uint8_t> &bits, CullBackend backend) const;
+
+    // Replaces indices with the ascending indices of the points inside the frustum
+    void cullIndices(const math::PointCloudSoA &points, std::vector<std::uint32_t> &indices) const;
+
+    // Fastest backend the host CPU supports; resolved once
+    static CullBackend bestBackend();
+    static bool isBackendSupported(CullBackend backend);
+
+    [[nodiscard]] const math::Point &getOrigin() const { return origin_; }
+    [[nodiscard]] const math::Vector &getFront() const { return front_; }
+    [[nodiscard]] const std::array<math::Point, CORNER_COUNT> &getCorners() const { return corners_; }
+    [[nodiscard]] const std::array<math::Vector, CORNER_COUNT> &getPlaneNormals() const { return planeNormals_; }
+    [[nodiscard]] float getRange() const { return range_; }
+    [[nodiscard]] float getRangeSquared() const { return rangeSquared_; }
+
+private:
+    bool containsOffset(float dx, float dy, float dz) const;
+
+    math::Point origin_;
+    math::Vector front_;
+    std::array<math::Point, CORNER_COUNT> corners_;
+    std::array<math::Vector, CORNER_COUNT> planeNormals_;
+    float range_;
+    float rangeSquared_;
+};
@@ -12,85 +12,59 @@ Device::Device(const DeviceConfig &config)
     setTransformNode(std::make_shared<spatial::TransformNode>(config.transform));
 }
 
-std::shared_ptr<math::PointCloud> Device::pointsInFov(const math::PointCloud &pcd) const
+std::shared_ptr<const DeviceFrustum> Device::getFrustum() const
 {
-    float fovH = this->getHorizontalFovRad();
-    float fovV = this->getVerticalFovRad();
-    float range = this->getRange();
-
-    float halfW = range * tanf(fovH / math::constants::HALF_DIVISOR_F);
-    float halfH = range * tanf(fovV / math::constants::HALF_DIVISOR_F);
-
-    auto newPoint1 = std::make_shared<spatial::TransformNode>();
-    auto newPoint2 = std::make_shared<spatial::TransformNode>();
-    auto newPoint3 = std::make_shared<spatial::TransformNode>();
-    auto newPoint4 = std::make_shared<spatial::TransformNode>();
+    const auto &node = getTransformNode();
+    // getGlobalVersion() refreshes a dirty node, so the version read here is current.
+    const std::uint64_t version = node->getGlobalVersion();
 
-    this->getTransformNode()->addChild(newPoint1);
-    this->getTransformNode()->addChild(newPoint2);
-    this->getTransformNode()->addChild(newPoint3);
-    this->getTransformNode()->addChild(newPoint4);
-
-    // Set local transforms for each FOV corner
-    newPoint1->setLocalTransform(spatial::Transform({range, -halfW, halfH}, {0.0F, 0.0F, 0.0F}));
-    newPoint2->setLocalTransform(spatial::Transform({range, halfW, halfH}, {0.0F, 0.0F, 0.0F}));
-    newPoint3->setLocalTransform(spatial::Transform({range, halfW, -halfH}, {0.0F, 0.0F, 0.0F}));
-    newPoint4->setLocalTransform(spatial::Transform({range, -halfW, -halfH}, {0.0F, 0.0F, 0.0F}));
+    std::lock_guard<std::mutex> lock(frustumCache_.mutex);
+    auto &cache = frustumCache_;
+    if (!cache.frustum || cache.node.lock() != node || cache.poseVersion != version)
+    {
+        cache.frustum = std::make_shared<const DeviceFrustum>(
+            node->getGlobalTransform(), horizontal_fov_rad_, vertical_fov_rad_, range_);
+        cache.node = node;
+        cache.poseVersion = version;
+    }
+    return cache.frustum;
+}
 
-    // Now get the global positions (which will include the transmitter's orientation)
-    math::Point p1 = newPoint1->getGlobalTransform().getPosition();
-    math::Point p2 = newPoint2->getGlobalTransform().getPosition();
-    math::Point p3 = newPoint3->getGlobalTransform().getPosition();
-    math::Point p4 = newPoint4->getGlobalTransform().getPosition();
+void Device::invalidateFrustum()
+{
+    std::lock_guard<std::mutex> lock(frustumCache_.mutex);
+    frustumCache_.frustum.reset();
+}
 
-    math::Point device_origin = this->getTransformNode()->getGlobalTransform().getPosition();
-    math::Vector device_front = this->getTransformNode()->getGlobalTransform().get3DDirectionVector();
+Device::FrustumCache &Device::FrustumCache::operator=(const FrustumCache &other)
+{
+    if (this != &other)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        frustum.reset();
+        node.reset();
+        poseVersion = 0;
+    }
+    return *this;
+}
 
-    math::Vector v1 = p1.toVectorFrom(device_origin);
-    math::Vector v2 = p2.toVectorFrom(device_origin);
-    math::Vector v3 = p3.toVectorFrom(device_origin);
-    math::Vector v4 = p4.toVectorFrom(device_origin);
+std::shared_ptr<math::PointCloud> Device::pointsInFov(const math::PointCloud &pcd) const
+{
+    const auto frustum = getFrustum();
 
-    auto visible = std::make_shared<math::PointCloud>();
+    std::vector<std::uint32_t> indices;
+    frustum->cullIndices(math::PointCloudSoA(pcd), indices);
 
-    for (const auto &point : pcd.getPoints())
+    const auto &points = pcd.getPoints();
+    std::vector<math::Point> selected;
+    selected.reserve(indices.size());
+    for (const auto index : indices)
     {
-        // calculate the distance between device and point
-        float distance = device_origin.distanceTo(point);
-        if (distance > range)
-        {
-            continue; // Point is out of range
-        }
-        auto cornerPoint1 = math::helper::intersectLinePlane(point, device_front, device_origin, v1);
-        auto cornerPoint2 = math::helper::intersectLinePlane(point, device_front, device_origin, v2);
-        auto cornerPoint3 = math::helper::intersectLinePlane(point, device_front, device_origin, v3);
-        auto cornerPoint4 = math::helper::intersectLinePlane(point, device_front, device_origin, v4);
-
-        if (!cornerPoint1 || !cornerPoint2 || !cornerPoint3 || !cornerPoint4)
-        {
-            continue; // Skip points that do not intersect with the plane defined by the FOV corners
-        }
-
-        // Calculate centroid by averaging coordinates directly
-        math::Point centerP(
-            (cornerPoint1->x() + cornerPoint2->x() + cornerPoint3->x() + cornerPoint4->x()) / 4.0f,
-            (cornerPoint1->y() + cornerPoint2->y() + cornerPoint3->y() + cornerPoint4->y()) / 4.0f,
-            (cornerPoint1->z() + cornerPoint2->z() + cornerPoint3->z() + cornerPoint4->z()) / 4.0f);
-
-        auto vector2Plane = centerP.toVectorFrom(device_origin);
-        // Check if point is behind device: no need to normalize for sign check
-        if (vector2Plane.dot(device_front) < 0.0f)
-        {
-            continue; // Point is behind the device
-        }
-
-        auto isInConvex = math::helper::isPointInConvexQuad(point, cornerPoint1.value(), cornerPoint2.value(), cornerPoint3.value(), cornerPoint4.value());
-        if (isInConvex)
-        {
-            visible->addPoint(point);
-        }
+        selected.push_back(points[index]);
     }
 
+    auto visible = std::make_shared<math::PointCloud>();
+    visible->addPoints(selected);
     return visible;
 }
 
@@ -102,6 +76,7 @@ float Device::getHorizontalFovDeg() const
 void Device::setHorizontalFovDeg(float horizontalFovDeg)
 {
     horizontal_fov_rad_ = math::RotationUtils::deg2rad(horizontalFovDeg);
+    invalidateFrustum();
 }
 
 float Device::getVerticalFovDeg() const
@@ -112,6 +87,7 @@ float Device::getVerticalFovDeg() const
 void Device::setVerticalFovDeg(float verticalFovDeg)
 {
     vertical_fov_rad_ = math::RotationUtils::deg2rad(verticalFovDeg);
+    invalidateFrustum();
 }
 
 float Device::getHorizontalFovRad() const
@@ -122,6 +98,7 @@ float Device::getHorizontalFovRad() const
 void Device::setHorizontalFovRad(float horizontalFovRad)
 {
     horizontal_fov_rad_ = horizontalFovRad;
+    invalidateFrustum();
 }
 
 float Device::getVerticalFovRad() const
@@ -132,6 +109,7 @@ float Device::getVerticalFovRad() const
 void Device::setVerticalFovRad(float verticalFovRad)
 {
     vertical_fov_rad_ = verticalFovRad;
+    invalidateFrustum();
 }
 
 const float &Device::getRange() const
@@ -142,6 +120,7 @@ const float &Device::getRange() const
 void Device::setRange(float newRange)
 {
     range_ = newRange;
+    invalidateFrustum();
 }
 
 std::string Device::toString() const
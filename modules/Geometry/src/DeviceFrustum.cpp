@@ -0,0 +1,117 @@
+#include <geometry/implementations/DeviceFrustum.hpp>
+#include <math/Constants.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+DeviceFrustum::DeviceFrustum(const spatial::Transform &globalTransform,
+                             float horizontalFovRad,
+                             float verticalFovRad,
+                             float range)
+    : origin_(globalTransform.getPosition()),
+      front_(globalTransform.get3DDirectionVector()),
+      range_(range),
+      rangeSquared_(range * range)
+{
+    const float halfW = range * std::tan(horizontalFovRad / math::constants::HALF_DIVISOR_F);
+    const float halfH = range * std::tan(verticalFovRad / math::constants::HALF_DIVISOR_F);
+
+    const std::array<math::Point, CORNER_COUNT> localCorners = {
+        math::Point(range, -halfW, halfH),
+        math::Point(range, halfW, halfH),
+        math::Point(range, halfW, -halfH),
+        math::Point(range, -halfW, -halfH)};
+
+    // Corners are placed through the same transform composition a child node would use,
+    // so they match what the scene graph reports for the device's pose.
+    std::array<math::Vector, CORNER_COUNT> rays;
+    math::Vector axis(0.0F, 0.0F, 0.0F);
+    for (std::size_t i = 0; i < CORNER_COUNT; ++i)
+    {
+        const spatial::Transform corner(localCorners[i], math::Vector(0.0F, 0.0F, 0.0F));
+        corners_[i] = (globalTransform * corner).getPosition();
+        rays[i] = corners_[i].toVectorFrom(origin_);
+        axis += rays[i];
+    }
+
+    // Each side plane contains the apex and two neighbouring corner rays. Orient the
+    // normals so the pyramid axis lies on their positive side.
+    for (std::size_t i = 0; i < CORNER_COUNT; ++i)
+    {
+        math::Vector normal = rays[i].cross(rays[(i + 1) % CORNER_COUNT]);
+        if (normal.dot(axis) < 0.0F)
+        {
+            normal = normal * -1.0F;
+        }
+        planeNormals_[i] = normal;
+    }
+}
+
+bool DeviceFrustum::contains(const math::Point &point) const
+{
+    return containsOffset(point.x() - origin_.x(), point.y() - origin_.y(), point.z() - origin_.z());
+}
+
+// Shared by contains() and the kernel tails, so the scalar answer is defined in one place
+bool DeviceFrustum::containsOffset(float dx, float dy, float dz) const
+{
+    if (dx * dx + dy * dy + dz * dz > rangeSquared_)
+    {
+        return false; // Point is out of range
+    }
+
+    for (const auto &n : planeNormals_)
+    {
+        if (n.x() * dx + n.y() * dy + n.z() * dz <= 0.0F)
+        {
+            return false; // Outside (or on) one of the side planes
+        }
+    }
+    return true;
+}
+
+bool DeviceFrustum::intersects(const math::Aabb &box) const
+{
+    if (box.isEmpty())
+    {
+        return false;
+    }
+
+    // A small relative slack keeps the rejection conservative against the float rounding
+    // of the per-point test, so a box is never culled while one of its points passes contains().
+    constexpr float SLACK = 1e-5F;
+
+    if (box.distanceSquaredTo(origin_) > rangeSquared_ * (1.0F + SLACK))
+    {
+        return false; // Box lies entirely beyond the range sphere
+    }
+
+    const float reach = std::sqrt(box.maxDistanceSquaredTo(origin_));
+    for (const auto &n : planeNormals_)
+    {
+        // Largest n.(c - origin) over the box corners, picked per axis
+        const float maxSide = std::max(n.x() * (box.minX - origin_.x()), n.x() * (box.maxX - origin_.x())) +
+                              std::max(n.y() * (box.minY - origin_.y()), n.y() * (box.maxY - origin_.y())) +
+                              std::max(n.z() * (box.minZ - origin_.z()), n.z() * (box.maxZ - origin_.z()));
+        if (maxSide < -SLACK * n.magnitude() * reach)
+        {
+            return false; // Whole box is outside this side plane
+        }
+    }
+    return true;
+}
+
+void DeviceFrustum::cullIndices(const math::PointCloudSoA &points, std::vector<std::uint32_t> &indices) const
+{
+    std::vector<std::uint8_t> bits;
+    cullMask(points, bits);
+
+    indices.clear();
+    for (std::size_t byte = 0; byte < bits.size(); ++byte)
+    {
+        for (unsigned int b = bits[byte]; b != 0; b &= b - 1)
+        {
+            indices.push_back(static_cast<std::uint32_t>(byte * 8 + static_cast<std::size_t>(std::countr_zero(b))));
+        }
+    }
+}
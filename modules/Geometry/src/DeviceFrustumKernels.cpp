@@ -0,0 +1,200 @@
+// Batch frustum culling kernels for DeviceFrustum.
+//
+// All backends compute, per point:
+//   d      = p - origin
+//   inside = !(d.d > range^2) && !(n_i.d <= 0) for the four side planes
+// with the multiplications and additions in the same left-to-right order as
+// DeviceFrustum::containsOffset() and without fused multiply-add, so every backend
+// returns exactly the same bits as contains(). The negated comparisons keep NaN
+// handling identical to the scalar branches as well.
+
+#include <geometry/implementations/DeviceFrustum.hpp>
+#include <stdexcept>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ADSIL_FRUSTUM_X86_KERNELS 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    constexpr std::size_t BLOCK = 8; // points per output byte
+
+    struct KernelParams
+    {
+        float ox, oy, oz;
+        float rangeSquared;
+        float nx[DeviceFrustum::CORNER_COUNT];
+        float ny[DeviceFrustum::CORNER_COUNT];
+        float nz[DeviceFrustum::CORNER_COUNT];
+    };
+
+#ifdef ADSIL_FRUSTUM_X86_KERNELS
+    __attribute__((target("avx2"))) void cullBlocksAvx2(const KernelParams &k,
+                                                        const float *xs, const float *ys, const float *zs,
+                                                        std::size_t blocks, std::uint8_t *bits)
+    {
+        const __m256 ox = _mm256_set1_ps(k.ox);
+        const __m256 oy = _mm256_set1_ps(k.oy);
+        const __m256 oz = _mm256_set1_ps(k.oz);
+        const __m256 rangeSquared = _mm256_set1_ps(k.rangeSquared);
+        const __m256 zero = _mm256_setzero_ps();
+
+        __m256 nx[DeviceFrustum::CORNER_COUNT];
+        __m256 ny[DeviceFrustum::CORNER_COUNT];
+        __m256 nz[DeviceFrustum::CORNER_COUNT];
+        for (std::size_t p = 0; p < DeviceFrustum::CORNER_COUNT; ++p)
+        {
+            nx[p] = _mm256_set1_ps(k.nx[p]);
+            ny[p] = _mm256_set1_ps(k.ny[p]);
+            nz[p] = _mm256_set1_ps(k.nz[p]);
+        }
+
+        for (std::size_t b = 0; b < blocks; ++b)
+        {
+            const std::size_t i = b * BLOCK;
+            const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs + i), ox);
+            const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys + i), oy);
+            const __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(zs + i), oz);
+
+            const __m256 dist2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)),
+                                               _mm256_mul_ps(dz, dz));
+            __m256 inside = _mm256_cmp_ps(dist2, rangeSquared, _CMP_NGT_UQ);
+
+            for (std::size_t p = 0; p < DeviceFrustum::CORNER_COUNT; ++p)
+            {
+                const __m256 side = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx[p], dx), _mm256_mul_ps(ny[p], dy)),
+                                                  _mm256_mul_ps(nz[p], dz));
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(side, zero, _CMP_NLE_UQ));
+            }
+
+            bits[b] = static_cast<std::uint8_t>(_mm256_movemask_ps(inside));
+        }
+    }
+
+    __attribute__((target("sse"))) int cullQuadSse(const KernelParams &k,
+                                                   const float *xs, const float *ys, const float *zs)
+    {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs), _mm_set1_ps(k.ox));
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys), _mm_set1_ps(k.oy));
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(zs), _mm_set1_ps(k.oz));
+
+        const __m128 dist2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 inside = _mm_cmpngt_ps(dist2, _mm_set1_ps(k.rangeSquared));
+
+        for (std::size_t p = 0; p < DeviceFrustum::CORNER_COUNT; ++p)
+        {
+            const __m128 side = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(k.nx[p]), dx),
+                                                      _mm_mul_ps(_mm_set1_ps(k.ny[p]), dy)),
+                                           _mm_mul_ps(_mm_set1_ps(k.nz[p]), dz));
+            inside = _mm_and_ps(inside, _mm_cmpnle_ps(side, _mm_setzero_ps()));
+        }
+
+        return _mm_movemask_ps(inside);
+    }
+
+    __attribute__((target("sse"))) void cullBlocksSse(const KernelParams &k,
+                                                      const float *xs, const float *ys, const float *zs,
+                                                      std::size_t blocks, std::uint8_t *bits)
+    {
+        for (std::size_t b = 0; b < blocks; ++b)
+        {
+            const std::size_t i = b * BLOCK;
+            const int low = cullQuadSse(k, xs + i, ys + i, zs + i);
+            const int high = cullQuadSse(k, xs + i + 4, ys + i + 4, zs + i + 4);
+            bits[b] = static_cast<std::uint8_t>(low | (high << 4));
+        }
+    }
+#endif
+} // namespace
+
+bool DeviceFrustum::isBackendSupported(CullBackend backend)
+{
+    switch (backend)
+    {
+    case CullBackend::Scalar:
+        return true;
+#ifdef ADSIL_FRUSTUM_X86_KERNELS
+    case CullBackend::SSE:
+        return __builtin_cpu_supports("sse") != 0;
+    case CullBackend::AVX2:
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    default:
+        return false;
+    }
+}
+
+DeviceFrustum::CullBackend DeviceFrustum::bestBackend()
+{
+    static const CullBackend best = []
+    {
+        if (isBackendSupported(CullBackend::AVX2))
+        {
+            return CullBackend::AVX2;
+        }
+        if (isBackendSupported(CullBackend::SSE))
+        {
+            return CullBackend::SSE;
+        }
+        return CullBackend::Scalar;
+    }();
+    return best;
+}
+
+void DeviceFrustum::cullMask(const math::PointCloudSoA &points, std::vector<std::uint8_t> &bits) const
+{
+    cullMask(points, bits, bestBackend());
+}
+
+void DeviceFrustum::cullMask(const math::PointCloudSoA &points, std::vector<std::uint8_t> &bits, CullBackend backend) const
+{
+    if (!isBackendSupported(backend))
+    {
+        throw std::invalid_argument("DeviceFrustum: requested cull backend is not supported on this CPU");
+    }
+
+    const std::size_t count = points.size();
+    bits.assign((count + BLOCK - 1) / BLOCK, 0);
+
+    const float *xs = points.xData();
+    const float *ys = points.yData();
+    const float *zs = points.zData();
+
+    std::size_t blocks = 0;
+#ifdef ADSIL_FRUSTUM_X86_KERNELS
+    if (backend != CullBackend::Scalar)
+    {
+        KernelParams k{};
+        k.ox = origin_.x();
+        k.oy = origin_.y();
+        k.oz = origin_.z();
+        k.rangeSquared = rangeSquared_;
+        for (std::size_t p = 0; p < CORNER_COUNT; ++p)
+        {
+            k.nx[p] = planeNormals_[p].x();
+            k.ny[p] = planeNormals_[p].y();
+            k.nz[p] = planeNormals_[p].z();
+        }
+
+        blocks = count / BLOCK;
+        if (backend == CullBackend::AVX2)
+        {
+            cullBlocksAvx2(k, xs, ys, zs, blocks, bits.data());
+        }
+        else
+        {
+            cullBlocksSse(k, xs, ys, zs, blocks, bits.data());
+        }
+    }
+#endif
+
+    // Scalar path and the tail that does not fill a whole block
+    for (std::size_t i = blocks * BLOCK; i < count; ++i)
+    {
+        if (containsOffset(xs[i] - origin_.x(), ys[i] - origin_.y(), zs[i] - origin_.z()))
+        {
+            bits[i / BLOCK] = static_cast<std::uint8_t>(bits[i / BLOCK] | (1U << (i % BLOCK)));
+        }
+    }
+}
@@ -0,0 +1,363 @@
+#include <geometry/implementations/Device.hpp>
+#include <geometry/implementations/DeviceFrustum.hpp>
+#include <geometry/configs/DeviceConfig.hpp>
+#include <spatial/implementations/Transform.hpp>
+#include <spatial/implementations/TransformNode.hpp>
+#include <math/Point.hpp>
+#include <math/PointCloud.hpp>
+#include <math/MathHelper.hpp>
+#include <iostream>
+#include <cmath>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// Test assertion helpers
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+void assert_near(float actual, float expected, float tolerance, const std::string &message)
+{
+    if (std::abs(actual - expected) > tolerance)
+    {
+        std::cerr << "ASSERTION FAILED: " << message
+                  << " (expected: " << expected << ", actual: " << actual
+                  << ", tolerance: " << tolerance << ")" << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+static Device makeDevice(const spatial::Transform &transform)
+{
+    DeviceConfig config = {transform, 60.0f, 90.0f, 10.0f, "FrustumDevice"};
+    return Device(config);
+}
+
+void test_frustumContainment()
+{
+    std::cout << "\n=== Testing Frustum Containment ===" << std::endl;
+
+    Device device = makeDevice(spatial::Transform({0, 0, 0}, {0, 0, 0}));
+    auto frustum = device.getFrustum();
+
+    // Device looks along local +X; 90 deg horizontal (y), 60 deg vertical (z)
+    assert_true(frustum->contains(math::Point(5, 0, 0)), "Point straight ahead is inside");
+    assert_true(frustum->contains(math::Point(5, 4.9f, 0)), "Point just inside horizontal edge is inside");
+    assert_true(!frustum->contains(math::Point(5, 5.1f, 0)), "Point just outside horizontal edge is outside");
+    assert_true(!frustum->contains(math::Point(5, 0, 3.0f)), "Point above vertical edge is outside");
+    assert_true(!frustum->contains(math::Point(-5, 0, 0)), "Point behind device is outside");
+    assert_true(!frustum->contains(math::Point(10.5f, 0, 0)), "Point beyond range is outside");
+    assert_true(!frustum->contains(math::Point(0, 0, 0)), "Apex itself is not inside");
+}
+
+void test_frustumCorners()
+{
+    std::cout << "\n=== Testing Frustum Corners ===" << std::endl;
+
+    Device device = makeDevice(spatial::Transform({1, 2, 3}, {0, 0, 0}));
+    auto frustum = device.getFrustum();
+
+    float halfW = 10.0f * std::tan(static_cast<float>(M_PI) / 4.0f);
+    const auto &corner = frustum->getCorners()[0];
+    assert_near(corner.x(), 11.0f, 1e-4f, "Corner x is origin.x + range");
+    assert_near(corner.y(), 2.0f - halfW, 1e-4f, "Corner y is origin.y - halfW");
+    assert_near(frustum->getOrigin().z(), 3.0f, 1e-6f, "Origin follows the device position");
+}
+
+void test_frustumCachedPerPose()
+{
+    std::cout << "\n=== Testing Frustum Cache Invalidation ===" << std::endl;
+
+    auto parent = std::make_shared<spatial::TransformNode>();
+    Device device = makeDevice(spatial::Transform({0, 0, 0}, {0, 0, 0}));
+    parent->addChild(device.getTransformNode());
+
+    auto first = device.getFrustum();
+    assert_true(device.getFrustum() == first, "Frustum is reused while the pose is unchanged");
+
+    math::PointCloud cloud;
+    cloud.addPoint(math::Point(5, 0, 0));
+    for (int i = 0; i < 100; ++i)
+    {
+        (void)device.pointsInFov(cloud);
+    }
+    assert_true(device.getTransformNode()->getChildren().empty(), "pointsInFov does not attach nodes to the device");
+    assert_true(device.getFrustum() == first, "Repeated queries keep the same frustum");
+
+    parent->setLocalTransform(spatial::Transform({0, 20, 0}, {0, 0, 0}));
+    auto moved = device.getFrustum();
+    assert_true(moved != first, "Moving the parent rebuilds the frustum");
+    assert_near(moved->getOrigin().y(), 20.0f, 1e-5f, "Rebuilt frustum follows the new pose");
+    assert_true(!moved->contains(math::Point(5, 0, 0)), "Old point is no longer visible after the move");
+
+    device.setRange(50.0f);
+    assert_true(device.getFrustum() != moved, "Changing the range rebuilds the frustum");
+    assert_near(device.getFrustum()->getRange(), 50.0f, 1e-6f, "Rebuilt frustum uses the new range");
+}
+
+void test_frustumRotated()
+{
+    std::cout << "\n=== Testing Rotated Frustum ===" << std::endl;
+
+    // Yaw by 90 degrees: device now looks along +Y
+    Device device = makeDevice(spatial::Transform({0, 0, 0}, {0, 0, static_cast<float>(M_PI) / 2.0f}));
+    auto frustum = device.getFrustum();
+
+    assert_true(frustum->contains(math::Point(0, 5, 0)), "Point along +Y is inside after yaw");
+    assert_true(!frustum->contains(math::Point(5, 0, 0)), "Point along +X is outside after yaw");
+    assert_near(frustum->getFront().y(), 1.0f, 1e-5f, "Front direction follows the yaw");
+}
+
+void test_cullKernelsMatchContains()
+{
+    std::cout << "\n=== Testing Cull Kernels Against contains() ===" << std::endl;
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> coord(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+    // Odd size so every backend also exercises the scalar tail
+    math::PointCloud cloud;
+    for (int i = 0; i < 20003; ++i)
+    {
+        cloud.addPoint(math::Point(coord(rng), coord(rng), coord(rng)));
+    }
+
+    const spatial::Transform poses[] = {
+        spatial::Transform({0, 0, 0}, {0, 0, 0}),
+        spatial::Transform({1.5f, -2.0f, 0.5f}, {0.1f, -0.3f, 0.8f}),
+        spatial::Transform({-3.0f, 4.0f, 1.0f}, {0.0f, 0.5f, 2.5f})};
+
+    for (const auto &pose : poses)
+    {
+        Device device = makeDevice(pose);
+        auto frustum = device.getFrustum();
+
+        // Points exactly on corner rays and at the range boundary stress the comparisons
+        math::PointCloud edgeCloud = cloud;
+        for (const auto &corner : frustum->getCorners())
+        {
+            auto ray = corner.toVectorFrom(frustum->getOrigin());
+            edgeCloud.addPoint(frustum->getOrigin() + ray * unit(rng));
+            edgeCloud.addPoint(corner);
+        }
+        edgeCloud.addPoint(frustum->getOrigin() + frustum->getFront() * frustum->getRange());
+        edgeCloud.addPoint(frustum->getOrigin());
+        edgeCloud.addPoint(math::Point(std::numeric_limits<float>::quiet_NaN(), 0, 0));
+
+        const math::PointCloudSoA soa(edgeCloud);
+        const auto &points = edgeCloud.getPoints();
+
+        for (auto backend : {DeviceFrustum::CullBackend::Scalar,
+                             DeviceFrustum::CullBackend::SSE,
+                             DeviceFrustum::CullBackend::AVX2})
+        {
+            if (!DeviceFrustum::isBackendSupported(backend))
+            {
+                std::cout << "  (backend " << static_cast<int>(backend) << " not supported, skipped)" << std::endl;
+                continue;
+            }
+
+            std::vector<std::uint8_t> bits;
+            frustum->cullMask(soa, bits, backend);
+
+            bool identical = bits.size() == (points.size() + 7) / 8;
+            for (std::size_t i = 0; identical && i < points.size(); ++i)
+            {
+                const bool kernel = ((bits[i / 8] >> (i % 8)) & 1U) != 0;
+                identical = kernel == frustum->contains(points[i]);
+            }
+            assert_true(identical, "Backend " + std::to_string(static_cast<int>(backend)) +
+                                       " matches contains() for every point");
+        }
+
+        std::vector<std::uint32_t> indices;
+        frustum->cullIndices(soa, indices);
+        std::size_t expected = 0;
+        bool ordered = true;
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            if (frustum->contains(points[i]))
+            {
+                ordered = ordered && expected < indices.size() && indices[expected] == i;
+                ++expected;
+            }
+        }
+        assert_true(ordered && expected == indices.size(), "cullIndices lists exactly the inside points in order");
+    }
+}
+
+// The FOV test Device::pointsInFov used before DeviceFrustum: intersect the four corner
+// rays with the plane through the point facing the device, then test the point against
+// that quad.
+static bool baselineContains(const DeviceFrustum &frustum, const math::Point &point)
+{
+    const auto &origin = frustum.getOrigin();
+    const auto &front = frustum.getFront();
+    if (origin.distanceTo(point) > frustum.getRange())
+    {
+        return false;
+    }
+
+    std::array<math::Point, DeviceFrustum::CORNER_COUNT> quad;
+    for (std::size_t i = 0; i < DeviceFrustum::CORNER_COUNT; ++i)
+    {
+        auto hit = math::helper::intersectLinePlane(point, front, origin, frustum.getCorners()[i].toVectorFrom(origin));
+        if (!hit)
+        {
+            return false;
+        }
+        quad[i] = *hit;
+    }
+
+    math::Point center((quad[0].x() + quad[1].x() + quad[2].x() + quad[3].x()) / 4.0f,
+                       (quad[0].y() + quad[1].y() + quad[2].y() + quad[3].y()) / 4.0f,
+                       (quad[0].z() + quad[1].z() + quad[2].z() + quad[3].z()) / 4.0f);
+    if (center.toVectorFrom(origin).dot(front) < 0.0f)
+    {
+        return false;
+    }
+    return math::helper::isPointInConvexQuad(point, quad[0], quad[1], quad[2], quad[3]);
+}
+
+// True when the point lies within a relative slack of the range sphere or a side plane,
+// where the two formulations round differently and may disagree.
+static bool nearBoundary(const DeviceFrustum &frustum, const math::Point &point, float slack)
+{
+    const auto offset = point.toVectorFrom(frustum.getOrigin());
+    const float distance = offset.magnitude();
+    if (std::abs(distance - frustum.getRange()) <= slack * frustum.getRange())
+    {
+        return true;
+    }
+    for (const auto &n : frustum.getPlaneNormals())
+    {
+        if (std::abs(n.dot(offset)) <= slack * n.magnitude() * distance)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_containsMatchesBaseline()
+{
+    std::cout << "\n=== Testing contains() Against The Quad-Projection Baseline ===" << std::endl;
+
+    constexpr float SLACK = 1e-4f;
+    std::mt19937 rng(2024);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> angle(-static_cast<float>(M_PI), static_cast<float>(M_PI));
+    std::uniform_real_distribution<float> fov(20.0f, 150.0f);
+    std::uniform_real_distribution<float> range(5.0f, 60.0f);
+    std::uniform_real_distribution<float> unit(-1.2f, 1.2f);
+
+    std::size_t inside = 0;
+    std::size_t boundary = 0;
+    bool agree = true;
+    for (int pose = 0; pose < 50 && agree; ++pose)
+    {
+        DeviceConfig config = {spatial::Transform({position(rng), position(rng), position(rng)},
+                                                  {angle(rng), angle(rng), angle(rng)}),
+                               fov(rng), fov(rng), range(rng), "RandomDevice"};
+        Device device(config);
+        auto frustum = device.getFrustum();
+
+        for (int i = 0; i < 2000; ++i)
+        {
+            const math::Point point = frustum->getOrigin() +
+                                      math::Vector(unit(rng), unit(rng), unit(rng)) * frustum->getRange();
+            const bool expected = baselineContains(*frustum, point);
+            if (frustum->contains(point) != expected)
+            {
+                if (!nearBoundary(*frustum, point, SLACK))
+                {
+                    std::cerr << "  mismatch at " << point.toString() << " pose " << pose << std::endl;
+                    agree = false;
+                    break;
+                }
+                ++boundary;
+            }
+            inside += expected ? 1 : 0;
+        }
+    }
+
+    assert_true(agree, "contains() matches the baseline away from the boundary slack");
+    assert_true(inside > 1000, "Random poses put a meaningful number of points inside");
+    std::cout << "  (" << boundary << " boundary disagreements within slack)" << std::endl;
+}
+
+void test_cullKernelsMatchScalarOnRandomClouds()
+{
+    std::cout << "\n=== Testing SIMD Cull Kernels Against Scalar On Random Clouds ===" << std::endl;
+
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+    std::uniform_real_distribution<float> angle(-static_cast<float>(M_PI), static_cast<float>(M_PI));
+    std::uniform_real_distribution<float> fov(20.0f, 150.0f);
+    std::uniform_real_distribution<float> unit(-1.2f, 1.2f);
+    std::uniform_int_distribution<int> size(1, 3000);
+
+    for (auto backend : {DeviceFrustum::CullBackend::SSE, DeviceFrustum::CullBackend::AVX2})
+    {
+        if (!DeviceFrustum::isBackendSupported(backend))
+        {
+            std::cout << "  (backend " << static_cast<int>(backend) << " not supported, skipped)" << std::endl;
+            continue;
+        }
+
+        bool identical = true;
+        for (int trial = 0; trial < 40 && identical; ++trial)
+        {
+            DeviceConfig config = {spatial::Transform({position(rng), position(rng), position(rng)},
+                                                      {angle(rng), angle(rng), angle(rng)}),
+                                   fov(rng), fov(rng), 30.0f, "RandomDevice"};
+            Device device(config);
+            auto frustum = device.getFrustum();
+
+            // Odd sizes exercise the kernel tails
+            math::PointCloud cloud;
+            const int count = size(rng);
+            for (int i = 0; i < count; ++i)
+            {
+                cloud.addPoint(frustum->getOrigin() + math::Vector(unit(rng), unit(rng), unit(rng)) * 30.0f);
+            }
+            const math::PointCloudSoA soa(cloud);
+
+            std::vector<std::uint8_t> scalar;
+            std::vector<std::uint8_t> simd;
+            frustum->cullMask(soa, scalar, DeviceFrustum::CullBackend::Scalar);
+            frustum->cullMask(soa, simd, backend);
+            identical = scalar == simd;
+        }
+        assert_true(identical, "Backend " + std::to_string(static_cast<int>(backend)) +
+                                   " mask equals the scalar mask on random clouds");
+    }
+}
+
+int main()
+{
+    std::cout << "📐 Starting DeviceFrustum Tests" << std::endl;
+    std::cout << "===============================" << std::endl;
+
+    test_frustumContainment();
+    test_frustumCorners();
+    test_frustumCachedPerPose();
+    test_frustumRotated();
+    test_cullKernelsMatchContains();
+    test_containsMatchesBaseline();
+    test_cullKernelsMatchScalarOnRandomClouds();
+
+    std::cout << "\n🎉 All DeviceFrustum tests passed!" << std::endl;
+    return 0;
+}
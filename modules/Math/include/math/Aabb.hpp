@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Point.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace math
+{
+    /**
+     * @struct Aabb
+     * @brief Axis-aligned bounding box stored as plain floats.
+     *
+     * Default-constructed boxes are empty (min > max) so they can be grown with expand().
+     */
+    struct Aabb
+    {
+        float minX = std::numeric_limits<float>::max();
+        float minY = std::numeric_limits<float>::max();
+        float minZ = std::numeric_limits<float>::max();
+        float maxX = std::numeric_limits<float>::lowest();
+        float maxY = std::numeric_limits<float>::lowest();
+        float maxZ = std::numeric_limits<float>::lowest();
+
+        bool isEmpty() const { return minX > maxX || minY > maxY || minZ > maxZ; }
+
+        void expand(float x, float y, float z)
+        {
+            minX = std::min(minX, x);
+            minY = std::min(minY, y);
+            minZ = std::min(minZ, z);
+            maxX = std::max(maxX, x);
+            maxY = std::max(maxY, y);
+            maxZ = std::max(maxZ, z);
+        }
+
+        void expand(const Aabb &other)
+        {
+            minX = std::min(minX, other.minX);
+            minY = std::min(minY, other.minY);
+            minZ = std::min(minZ, other.minZ);
+            maxX = std::max(maxX, other.maxX);
+            maxY = std::max(maxY, other.maxY);
+            maxZ = std::max(maxZ, other.maxZ);
+        }
+
+        bool contains(float x, float y, float z) const
+        {
+            return x >= minX && x <= maxX && y >= minY && y <= maxY && z >= minZ && z <= maxZ;
+        }
+
+        bool overlaps(const Aabb &other) const
+        {
+            return minX <= other.maxX && maxX >= other.minX &&
+                   minY <= other.maxY && maxY >= other.minY &&
+                   minZ <= other.maxZ && maxZ >= other.minZ;
+        }
+
+        // Squared distance from p to the closest point of the box (0 when p is inside)
+        float distanceSquaredTo(const Point &p) const
+        {
+            const float dx = std::max({minX - p.x(), 0.0F, p.x() - maxX});
+            const float dy = std::max({minY - p.y(), 0.0F, p.y() - maxY});
+            const float dz = std::max({minZ - p.z(), 0.0F, p.z() - maxZ});
+            return dx * dx + dy * dy + dz * dz;
+        }
+
+        // Squared distance from p to the farthest corner of the box
+        float maxDistanceSquaredTo(const Point &p) const
+        {
+            const float dx = std::max(p.x() - minX, maxX - p.x());
+            const float dy = std::max(p.y() - minY, maxY - p.y());
+            const float dz = std::max(p.z() - minZ, maxZ - p.z());
+            return dx * dx + dy * dy + dz * dz;
+        }
+    };
+}
@@ -12,6 +12,7 @@ namespace math
     public:
         PointCloud() = default;
         PointCloud(const std::vector<math::Point> &points);
+        explicit PointCloud(std::vector<math::Point> &&points);
 
         void addPoint(const Point &point);
         void addPoints(const std::vector<math::Point> &newPoints);
@@ -23,6 +24,9 @@ namespace math
 
         void clear();
 
+        // Moves the point storage out (capacity included), leaving the cloud empty
+        std::vector<math::Point> takePoints();
+
         // Merge two point clouds
         PointCloud operator+(const PointCloud &other) const;
 
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "PointCloud.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace math
+{
+    /**
+     * @class PointCloudSoA
+     * @brief Structure-of-arrays copy of a PointCloud for vectorized kernels.
+     *
+     * x, y and z are stored in separate contiguous float arrays so SIMD code can load
+     * several points per instruction. assign() reuses the existing capacity, so one
+     * instance can be refilled every frame without reallocating.
+     */
+    class PointCloudSoA
+    {
+    public:
+        PointCloudSoA() = default;
+        explicit PointCloudSoA(const PointCloud &cloud);
+
+        void assign(const PointCloud &cloud);
+        void clear();
+
+        std::size_t size() const { return xs_.size(); }
+        bool empty() const { return xs_.empty(); }
+
+        const float *xData() const { return xs_.data(); }
+        const float *yData() const { return ys_.data(); }
+        const float *zData() const { return zs_.data(); }
+
+    private:
+        std::vector<float> xs_;
+        std::vector<float> ys_;
+        std::vector<float> zs_;
+    };
+}
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "Aabb.hpp"
+#include "Point.hpp"
+#include "PointCloud.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <vector>
+
+namespace core
+{
+    class ThreadPool;
+}
+
+namespace math
+{
+    /**
+     * @class PointKdTree
+     * @brief Implicit, balanced k-d tree over a point cloud, stored in flat arrays.
+     *
+     * Each split puts the median point of the node's range on the node's widest axis,
+     * so the tree is complete: node i has children 2i+1 and 2i+2 and every leaf sits at
+     * the same depth with at most LEAF_SIZE points. Points are copied into tree order as
+     * SoA float arrays; every node keeps its range and a tight bounding box.
+     *
+     * Given a thread pool, large clouds are built in parallel: the caller splits the upper
+     * levels and the pool builds the subtrees below them. Queries return indices into the
+     * cloud the tree was built from, in tree order (not sorted).
+     *
+     * @note Thread Safety: Immutable after build(); concurrent queries are safe.
+     */
+    class PointKdTree
+    {
+    public:
+        static constexpr std::size_t LEAF_SIZE = 32;
+
+        struct Node
+        {
+            Aabb bounds;
+            std::uint32_t begin = 0; // range into the tree-ordered point arrays
+            std::uint32_t end = 0;
+        };
+
+        static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        // Result of a nearest query: cloud index and its distance, or NO_INDEX when nothing qualified
+        struct Nearest
+        {
+            std::uint32_t index = NO_INDEX;
+            float distance = std::numeric_limits<float>::infinity();
+
+            bool found() const { return index != NO_INDEX; }
+            // Smaller distance wins; equal distances go to the smaller cloud index, which is
+            // what a linear scan with a strict '<' in cloud order would return
+            bool beats(const Nearest &other) const
+            {
+                return distance < other.distance || (distance == other.distance && index < other.index);
+            }
+        };
+
+        // Open node of a best-first search, ordered by its lower bound
+        struct BoundEntry
+        {
+            float bound;
+            std::size_t node;
+        };
+
+        // Work storage for the bistatic searches. Passing the same instance to repeated queries
+        // on one thread keeps them free of heap allocations once it has grown.
+        struct SearchScratch
+        {
+            std::vector<BoundEntry> open;
+        };
+
+        PointKdTree() = default;
+        // pool is optional; without one the tree is built on the calling thread. It must not be
+        // called from inside a task of that pool.
+        explicit PointKdTree(const PointCloud &cloud, core::ThreadPool *pool = nullptr);
+
+        void build(const PointCloud &cloud, core::ThreadPool *pool = nullptr);
+
+        std::size_t size() const { return ids_.size(); }
+        bool empty() const { return ids_.empty(); }
+        const Aabb &getBounds() const;
+
+        // Points within radius of center (inclusive)
+        void radiusSearch(const Point &center, float radius, std::vector<std::uint32_t> &out) const;
+        // Points inside box (inclusive)
+        void boxSearch(const Aabb &box, std::vector<std::uint32_t> &out) const;
+
+        /**
+         * Visits every point for which volume.contains(point) is true.
+         * Volume must provide:
+         *   bool intersects(const math::Aabb &) const; // false only if the box is entirely outside
+         *   bool contains(const math::Point &) const;
+         * Visitor is called as visit(std::uint32_t cloudIndex).
+         */
+        template <typename Volume, typename Visitor>
+        void query(const Volume &volume, Visitor &&visit) const;
+
+        /**
+         * Point p accepted by volume that minimises |p - a| + |p - b| (the bistatic range of a
+         * transmitter at a and a receiver at b), found by best-first branch and bound.
+         *
+         * Each node's lower bound is dist(a, box) + dist(b, box); subtrees whose bound cannot
+         * beat the best candidate, or that the volume rejects, are skipped, and the search stops
+         * once the best candidate beats every remaining bound. seed warm-starts the search with
+         * a known candidate (e.g. last frame's winner for the same pair); the caller must only
+         * pass a seed whose point the volume accepts. The result equals a linear scan.
+         * scratch is optional reusable work storage.
+         */
+        template <typename Volume>
+        Nearest nearestBistatic(const Point &a, const Point &b, const Volume &volume, Nearest seed = {},
+                                SearchScratch *scratch = nullptr) const;
+
+        /**
+         * The k points accepted by volume with the smallest bistatic range |p - a| + |p - b|,
+         * nearest first and ordered like Nearest::beats(); fewer when the volume accepts fewer.
+         * Same branch and bound as nearestBistatic(), pruning against the k-th best candidate
+         * kept in a bounded max-heap. out[0] equals nearestBistatic() when k >= 1.
+         */
+        template <typename Volume>
+        void kNearestBistatic(const Point &a, const Point &b, const Volume &volume, std::size_t k, std::vector<Nearest> &out,
+                              SearchScratch *scratch = nullptr) const;
+
+        // Node-level access for specialised traversals
+        const std::vector<Node> &getNodes() const { return nodes_; }
+        bool isLeaf(std::size_t node) const { return node >= firstLeaf_; }
+        static std::size_t leftChild(std::size_t node) { return 2 * node + 1; }
+        static std::size_t rightChild(std::size_t node) { return 2 * node + 2; }
+
+        // Tree-ordered point storage; slot is in [node.begin, node.end)
+        float x(std::size_t slot) const { return xs_[slot]; }
+        float y(std::size_t slot) const { return ys_[slot]; }
+        float z(std::size_t slot) const { return zs_[slot]; }
+        Point pointAt(std::size_t slot) const { return {xs_[slot], ys_[slot], zs_[slot]}; }
+        std::uint32_t cloudIndex(std::size_t slot) const { return ids_[slot]; }
+
+    private:
+        // Depth-first traversal pushes at most depth + 1 nodes; 32-bit point counts keep depth < 32
+        static constexpr std::size_t MAX_STACK = 64;
+        // Node bounds are shrunk by this relative amount so float rounding never prunes a winner
+        static constexpr float BOUND_SLACK = 1e-5F;
+        // Below this many points a single thread builds faster than handing work to a pool
+        static constexpr std::size_t PARALLEL_BUILD_THRESHOLD = 1U << 14;
+
+        // Node range left for the pool once the upper levels are split
+        struct Subtree
+        {
+            std::size_t node;
+            std::uint32_t begin;
+            std::uint32_t end;
+            Aabb splitBox;
+        };
+
+        // Min-heap on the bound, kept in a SearchScratch so its storage is reused
+        static void pushOpen(std::vector<BoundEntry> &open, BoundEntry entry)
+        {
+            open.push_back(entry);
+            std::push_heap(open.begin(), open.end(), laterBound);
+        }
+        static BoundEntry popOpen(std::vector<BoundEntry> &open)
+        {
+            std::pop_heap(open.begin(), open.end(), laterBound);
+            const BoundEntry entry = open.back();
+            open.pop_back();
+            return entry;
+        }
+        static bool laterBound(const BoundEntry &lhs, const BoundEntry &rhs) { return lhs.bound > rhs.bound; }
+
+        // Builds the node and everything below it
+        void buildNode(const std::vector<Point> &points,
+                       std::size_t node,
+                       std::uint32_t begin,
+                       std::uint32_t end,
+                       const Aabb &splitBox);
+
+        // Splits `levels` levels below the node and appends the subtrees under them to
+        // `subtrees`; their bounds are filled in later by finishSplitNodes()
+        void splitNode(const std::vector<Point> &points,
+                       std::size_t node,
+                       std::uint32_t begin,
+                       std::uint32_t end,
+                       const Aabb &splitBox,
+                       std::size_t levels,
+                       std::vector<Subtree> &subtrees);
+
+        // Partitions the node's range at the median of its widest axis and returns the middle
+        std::uint32_t splitRange(const std::vector<Point> &points,
+                                 std::uint32_t begin,
+                                 std::uint32_t end,
+                                 const Aabb &splitBox,
+                                 Aabb &leftBox,
+                                 Aabb &rightBox);
+
+        std::vector<Node> nodes_;
+        std::size_t firstLeaf_ = 0;
+
+        std::vector<float> xs_;
+        std::vector<float> ys_;
+        std::vector<float> zs_;
+        std::vector<std::uint32_t> ids_;
+    };
+
+    template <typename Volume, typename Visitor>
+    void PointKdTree::query(const Volume &volume, Visitor &&visit) const
+    {
+        if (nodes_.empty())
+        {
+            return;
+        }
+
+        std::size_t stack[MAX_STACK];
+        std::size_t top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const std::size_t node = stack[--top];
+            const Node &n = nodes_[node];
+            if (n.begin == n.end || !volume.intersects(n.bounds))
+            {
+                continue;
+            }
+
+            if (isLeaf(node))
+            {
+                for (std::size_t slot = n.begin; slot < n.end; ++slot)
+                {
+                    if (volume.contains(pointAt(slot)))
+                    {
+                        visit(ids_[slot]);
+                    }
+                }
+                continue;
+            }
+
+            stack[top++] = rightChild(node);
+            stack[top++] = leftChild(node);
+        }
+    }
+
+    template <typename Volume>
+    PointKdTree::Nearest PointKdTree::nearestBistatic(const Point &a, const Point &b, const Volume &volume, Nearest seed,
+                                                      SearchScratch *scratch) const
+    {
+        Nearest best = seed;
+        if (nodes_.empty())
+        {
+            return best;
+        }
+
+        auto lowerBound = [&a, &b](const Aabb &box)
+        {
+            const float bound = std::sqrt(box.distanceSquaredTo(a)) + std::sqrt(box.distanceSquaredTo(b));
+            return bound * (1.0F - BOUND_SLACK);
+        };
+
+        SearchScratch local;
+        std::vector<BoundEntry> &open = scratch ? scratch->open : local.open;
+        open.clear();
+        pushOpen(open, {lowerBound(nodes_.front().bounds), 0});
+
+        while (!open.empty())
+        {
+            const BoundEntry entry = popOpen(open);
+            if (entry.bound > best.distance)
+            {
+                break; // Every remaining node is at least this far: the best cannot change
+            }
+
+            const Node &n = nodes_[entry.node];
+            if (n.begin == n.end || !volume.intersects(n.bounds))
+            {
+                continue;
+            }
+
+            if (isLeaf(entry.node))
+            {
+                for (std::size_t slot = n.begin; slot < n.end; ++slot)
+                {
+                    const Point p = pointAt(slot);
+                    const Nearest candidate{ids_[slot], p.distanceTo(a) + p.distanceTo(b)};
+                    if (candidate.beats(best) && volume.contains(p))
+                    {
+                        best = candidate;
+                    }
+                }
+                continue;
+            }
+
+            for (const std::size_t child : {leftChild(entry.node), rightChild(entry.node)})
+            {
+                const float bound = lowerBound(nodes_[child].bounds);
+                if (bound <= best.distance)
+                {
+                    pushOpen(open, {bound, child});
+                }
+            }
+        }
+        return best;
+    }
+
+    template <typename Volume>
+    void PointKdTree::kNearestBistatic(const Point &a, const Point &b, const Volume &volume, std::size_t k, std::vector<Nearest> &out,
+                                       SearchScratch *scratch) const
+    {
+        out.clear();
+        if (nodes_.empty() || k == 0)
+        {
+            return;
+        }
+
+        // Max-heap on beats(): the front is the worst of the kept candidates
+        const auto worse = [](const Nearest &lhs, const Nearest &rhs)
+        { return lhs.beats(rhs); };
+        const auto threshold = [&]
+        { return out.size() < k ? std::numeric_limits<float>::infinity() : out.front().distance; };
+
+        auto lowerBound = [&a, &b](const Aabb &box)
+        {
+            const float bound = std::sqrt(box.distanceSquaredTo(a)) + std::sqrt(box.distanceSquaredTo(b));
+            return bound * (1.0F - BOUND_SLACK);
+        };
+
+        SearchScratch local;
+        std::vector<BoundEntry> &open = scratch ? scratch->open : local.open;
+        open.clear();
+        pushOpen(open, {lowerBound(nodes_.front().bounds), 0});
+
+        while (!open.empty())
+        {
+            const BoundEntry entry = popOpen(open);
+            if (entry.bound > threshold())
+            {
+                break; // No remaining node can displace the k-th best
+            }
+
+            const Node &n = nodes_[entry.node];
+            if (n.begin == n.end || !volume.intersects(n.bounds))
+            {
+                continue;
+            }
+
+            if (isLeaf(entry.node))
+            {
+                for (std::size_t slot = n.begin; slot < n.end; ++slot)
+                {
+                    const Point p = pointAt(slot);
+                    const Nearest candidate{ids_[slot], p.distanceTo(a) + p.distanceTo(b)};
+                    const bool admits = out.size() < k || candidate.beats(out.front());
+                    if (!admits || !volume.contains(p))
+                    {
+                        continue;
+                    }
+                    if (out.size() == k)
+                    {
+                        std::pop_heap(out.begin(), out.end(), worse);
+                        out.pop_back();
+                    }
+                    out.push_back(candidate);
+                    std::push_heap(out.begin(), out.end(), worse);
+                }
+                continue;
+            }
+
+            for (const std::size_t child : {leftChild(entry.node), rightChild(entry.node)})
+            {
+                const float bound = lowerBound(nodes_[child].bounds);
+                if (bound <= threshold())
+                {
+                    pushOpen(open, {bound, child});
+                }
+            }
+        }
+
+        std::sort_heap(out.begin(), out.end(), worse);
+    }
+}
@@ -2,6 +2,9 @@
 
 #include "Point.hpp"
 #include "PointCloud.hpp"
+#include "PointCloudSoA.hpp"
+#include "Aabb.hpp"
+#include "PointKdTree.hpp"
 #include "Vector.hpp"
 #include "RotationUtils.hpp"
 #include "Constants.hpp"
@@ -1,11 +1,15 @@
 #include <math/PointCloud.hpp>
 #include <sstream>
+#include <utility>
 
 namespace math
 {
     PointCloud::PointCloud(const std::vector<math::Point> &points)
         : points_(points) {}
 
+    PointCloud::PointCloud(std::vector<math::Point> &&points)
+        : points_(std::move(points)) {}
+
     void PointCloud::addPoint(const Point &point)
     {
         points_.emplace_back(point);
@@ -30,6 +34,11 @@ namespace math
         points_.clear();
     }
 
+    std::vector<math::Point> PointCloud::takePoints()
+    {
+        return std::exchange(points_, {});
+    }
+
     std::size_t PointCloud::size() const
     {
         return points_.size();
@@ -0,0 +1,31 @@
+#include <math/PointCloudSoA.hpp>
+
+namespace math
+{
+    PointCloudSoA::PointCloudSoA(const PointCloud &cloud)
+    {
+        assign(cloud);
+    }
+
+    void PointCloudSoA::assign(const PointCloud &cloud)
+    {
+        const auto &points = cloud.getPoints();
+        xs_.resize(points.size());
+        ys_.resize(points.size());
+        zs_.resize(points.size());
+
+        for (std::size_t i = 0; i < points.size(); ++i)
+        {
+            xs_[i] = points[i].x();
+            ys_[i] = points[i].y();
+            zs_[i] = points[i].z();
+        }
+    }
+
+    void PointCloudSoA::clear()
+    {
+        xs_.clear();
+        ys_.clear();
+        zs_.clear();
+    }
+}
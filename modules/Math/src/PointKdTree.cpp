@@ -0,0 +1,238 @@
+#include <math/PointKdTree.hpp>
+#include <core/ThreadPool.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+namespace math
+{
+    namespace
+    {
+        float coordinate(const Point &p, int axis)
+        {
+            return axis == 0 ? p.x() : (axis == 1 ? p.y() : p.z());
+        }
+
+        int widestAxis(const Aabb &box)
+        {
+            const float ex = box.maxX - box.minX;
+            const float ey = box.maxY - box.minY;
+            const float ez = box.maxZ - box.minZ;
+            if (ex >= ey && ex >= ez)
+            {
+                return 0;
+            }
+            return ey >= ez ? 1 : 2;
+        }
+
+        struct SphereVolume
+        {
+            Point center;
+            float radiusSquared;
+
+            bool intersects(const Aabb &box) const { return box.distanceSquaredTo(center) <= radiusSquared; }
+            bool contains(const Point &p) const
+            {
+                const float dx = p.x() - center.x();
+                const float dy = p.y() - center.y();
+                const float dz = p.z() - center.z();
+                return dx * dx + dy * dy + dz * dz <= radiusSquared;
+            }
+        };
+
+        struct BoxVolume
+        {
+            Aabb box;
+
+            bool intersects(const Aabb &other) const { return box.overlaps(other); }
+            bool contains(const Point &p) const { return box.contains(p.x(), p.y(), p.z()); }
+        };
+    } // namespace
+
+    PointKdTree::PointKdTree(const PointCloud &cloud, core::ThreadPool *pool)
+    {
+        build(cloud, pool);
+    }
+
+    void PointKdTree::build(const PointCloud &cloud, core::ThreadPool *pool)
+    {
+        const auto &points = cloud.getPoints();
+        const std::size_t count = points.size();
+
+        nodes_.clear();
+        firstLeaf_ = 0;
+        xs_.resize(count);
+        ys_.resize(count);
+        zs_.resize(count);
+        ids_.resize(count);
+
+        if (count == 0)
+        {
+            return;
+        }
+        if (count > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::length_error("PointKdTree supports at most 2^32 - 1 points");
+        }
+
+        // Smallest depth whose leaves (ceil(count / 2^depth) points) fit LEAF_SIZE
+        std::size_t depth = 0;
+        while (((count + (std::size_t{1} << depth) - 1) >> depth) > LEAF_SIZE)
+        {
+            ++depth;
+        }
+        firstLeaf_ = (std::size_t{1} << depth) - 1;
+        nodes_.resize((std::size_t{1} << (depth + 1)) - 1);
+
+        std::iota(ids_.begin(), ids_.end(), std::uint32_t{0});
+
+        Aabb rootBox;
+        for (const auto &p : points)
+        {
+            rootBox.expand(p.x(), p.y(), p.z());
+        }
+
+        // Split the top levels here so that level L leaves 2^L independent subtrees, enough
+        // to keep every worker and the caller busy
+        std::size_t parallelDepth = 0;
+        if (pool && count >= PARALLEL_BUILD_THRESHOLD)
+        {
+            const std::size_t threads = pool->getWorkerCount() + 1;
+            while ((std::size_t{1} << parallelDepth) < threads && parallelDepth < depth)
+            {
+                ++parallelDepth;
+            }
+        }
+
+        if (parallelDepth == 0)
+        {
+            buildNode(points, 0, 0, static_cast<std::uint32_t>(count), rootBox);
+            return;
+        }
+
+        std::vector<Subtree> subtrees;
+        subtrees.reserve(std::size_t{1} << parallelDepth);
+        splitNode(points, 0, 0, static_cast<std::uint32_t>(count), rootBox, parallelDepth, subtrees);
+
+        // Subtrees touch disjoint ranges of ids_/xs_/ys_/zs_ and disjoint nodes
+        pool->parallelFor(subtrees.size(), [&](std::size_t i)
+                          {
+            const auto &subtree = subtrees[i];
+            buildNode(points, subtree.node, subtree.begin, subtree.end, subtree.splitBox); });
+
+        // The split levels take their bounds from the finished subtrees, deepest level first
+        const std::size_t firstSubtree = (std::size_t{1} << parallelDepth) - 1;
+        for (std::size_t node = firstSubtree; node-- > 0;)
+        {
+            nodes_[node].bounds = nodes_[leftChild(node)].bounds;
+            nodes_[node].bounds.expand(nodes_[rightChild(node)].bounds);
+        }
+    }
+
+    std::uint32_t PointKdTree::splitRange(const std::vector<Point> &points,
+                                          std::uint32_t begin,
+                                          std::uint32_t end,
+                                          const Aabb &splitBox,
+                                          Aabb &leftBox,
+                                          Aabb &rightBox)
+    {
+        const int axis = widestAxis(splitBox);
+        const std::uint32_t mid = begin + (end - begin) / 2;
+        std::nth_element(ids_.begin() + begin, ids_.begin() + mid, ids_.begin() + end,
+                         [&points, axis](std::uint32_t a, std::uint32_t b)
+                         { return coordinate(points[a], axis) < coordinate(points[b], axis); });
+        const float split = coordinate(points[ids_[mid]], axis);
+
+        leftBox = splitBox;
+        rightBox = splitBox;
+        (axis == 0 ? leftBox.maxX : (axis == 1 ? leftBox.maxY : leftBox.maxZ)) = split;
+        (axis == 0 ? rightBox.minX : (axis == 1 ? rightBox.minY : rightBox.minZ)) = split;
+        return mid;
+    }
+
+    void PointKdTree::splitNode(const std::vector<Point> &points,
+                                std::size_t node,
+                                std::uint32_t begin,
+                                std::uint32_t end,
+                                const Aabb &splitBox,
+                                std::size_t levels,
+                                std::vector<Subtree> &subtrees)
+    {
+        if (levels == 0)
+        {
+            subtrees.push_back({node, begin, end, splitBox});
+            return;
+        }
+
+        Node &n = nodes_[node];
+        n.begin = begin;
+        n.end = end;
+
+        Aabb leftBox;
+        Aabb rightBox;
+        const std::uint32_t mid = splitRange(points, begin, end, splitBox, leftBox, rightBox);
+        splitNode(points, leftChild(node), begin, mid, leftBox, levels - 1, subtrees);
+        splitNode(points, rightChild(node), mid, end, rightBox, levels - 1, subtrees);
+    }
+
+    void PointKdTree::buildNode(const std::vector<Point> &points,
+                                std::size_t node,
+                                std::uint32_t begin,
+                                std::uint32_t end,
+                                const Aabb &splitBox)
+    {
+        Node &n = nodes_[node];
+        n.begin = begin;
+        n.end = end;
+
+        if (isLeaf(node))
+        {
+            // Leaves copy their points into tree order and compute tight bounds
+            Aabb bounds;
+            for (std::uint32_t slot = begin; slot < end; ++slot)
+            {
+                const Point &p = points[ids_[slot]];
+                xs_[slot] = p.x();
+                ys_[slot] = p.y();
+                zs_[slot] = p.z();
+                bounds.expand(p.x(), p.y(), p.z());
+            }
+            n.bounds = bounds;
+            return;
+        }
+
+        Aabb leftBox;
+        Aabb rightBox;
+        const std::uint32_t mid = splitRange(points, begin, end, splitBox, leftBox, rightBox);
+
+        const std::size_t left = leftChild(node);
+        const std::size_t right = rightChild(node);
+        buildNode(points, left, begin, mid, leftBox);
+        buildNode(points, right, mid, end, rightBox);
+
+        n.bounds = nodes_[left].bounds;
+        n.bounds.expand(nodes_[right].bounds);
+    }
+
+    const Aabb &PointKdTree::getBounds() const
+    {
+        static const Aabb emptyBounds;
+        return nodes_.empty() ? emptyBounds : nodes_.front().bounds;
+    }
+
+    void PointKdTree::radiusSearch(const Point &center, float radius, std::vector<std::uint32_t> &out) const
+    {
+        out.clear();
+        query(SphereVolume{center, radius * radius}, [&out](std::uint32_t index)
+              { out.push_back(index); });
+    }
+
+    void PointKdTree::boxSearch(const Aabb &box, std::vector<std::uint32_t> &out) const
+    {
+        out.clear();
+        query(BoxVolume{box}, [&out](std::uint32_t index)
+              { out.push_back(index); });
+    }
+}
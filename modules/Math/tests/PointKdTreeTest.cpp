@@ -0,0 +1,290 @@
+#include <math/PointKdTree.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+#include <core/ThreadPool.hpp>
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace math;
+
+static PointCloud randomCloud(std::size_t count, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-50.0F, 50.0F);
+    PointCloud cloud;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        cloud.addPoint(Point(dist(rng), dist(rng), dist(rng) * 0.1F)); // flat, like a ground scan
+    }
+    return cloud;
+}
+
+static std::vector<std::uint32_t> sorted(std::vector<std::uint32_t> v)
+{
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+void test_PointKdTree_empty()
+{
+    PointCloud cloud;
+    PointKdTree tree(cloud);
+    assert(tree.empty());
+    assert(tree.getBounds().isEmpty());
+
+    std::vector<std::uint32_t> out{1, 2};
+    tree.radiusSearch(Point(0.0F, 0.0F, 0.0F), 10.0F, out);
+    assert(out.empty());
+
+    std::cout << "[PASS] PointKdTree empty cloud test\n";
+}
+
+void test_PointKdTree_structure()
+{
+    auto cloud = randomCloud(1000, 3);
+    PointKdTree tree(cloud);
+    assert(tree.size() == 1000);
+
+    // Every cloud index appears exactly once in tree order, and leaves respect LEAF_SIZE
+    std::vector<std::uint32_t> ids;
+    const auto &nodes = tree.getNodes();
+    for (std::size_t node = 0; node < nodes.size(); ++node)
+    {
+        if (!tree.isLeaf(node))
+        {
+            continue;
+        }
+        assert(nodes[node].end - nodes[node].begin <= PointKdTree::LEAF_SIZE);
+        for (std::size_t slot = nodes[node].begin; slot < nodes[node].end; ++slot)
+        {
+            ids.push_back(tree.cloudIndex(slot));
+            assert(nodes[node].bounds.contains(tree.x(slot), tree.y(slot), tree.z(slot)));
+        }
+    }
+    ids = sorted(ids);
+    for (std::uint32_t i = 0; i < ids.size(); ++i)
+    {
+        assert(ids[i] == i);
+    }
+    assert(ids.size() == 1000);
+
+    std::cout << "[PASS] PointKdTree structure test\n";
+}
+
+void test_PointKdTree_radius_matches_bruteforce()
+{
+    // 50k points also exercises the parallel build
+    for (std::size_t count : {1U, 33U, 5000U, 50000U})
+    {
+        auto cloud = randomCloud(count, static_cast<unsigned>(count));
+        PointKdTree tree(cloud);
+
+        const Point center(3.0F, -4.0F, 0.5F);
+        const float radius = 12.0F;
+
+        std::vector<std::uint32_t> expected;
+        const auto &points = cloud.getPoints();
+        for (std::uint32_t i = 0; i < points.size(); ++i)
+        {
+            const float dx = points[i].x() - center.x();
+            const float dy = points[i].y() - center.y();
+            const float dz = points[i].z() - center.z();
+            if (dx * dx + dy * dy + dz * dz <= radius * radius)
+            {
+                expected.push_back(i);
+            }
+        }
+
+        std::vector<std::uint32_t> found;
+        tree.radiusSearch(center, radius, found);
+        assert(sorted(found) == expected);
+    }
+
+    std::cout << "[PASS] PointKdTree radius search test\n";
+}
+
+void test_PointKdTree_box_matches_bruteforce()
+{
+    auto cloud = randomCloud(20000, 11);
+    PointKdTree tree(cloud);
+
+    Aabb box;
+    box.expand(-10.0F, 5.0F, -1.0F);
+    box.expand(20.0F, 30.0F, 2.0F);
+
+    std::vector<std::uint32_t> expected;
+    const auto &points = cloud.getPoints();
+    for (std::uint32_t i = 0; i < points.size(); ++i)
+    {
+        if (box.contains(points[i].x(), points[i].y(), points[i].z()))
+        {
+            expected.push_back(i);
+        }
+    }
+
+    std::vector<std::uint32_t> found;
+    tree.boxSearch(box, found);
+    assert(sorted(found) == expected);
+    assert(!found.empty());
+
+    std::cout << "[PASS] PointKdTree box search test\n";
+}
+
+// Half-space x >= minX, standing in for a device FOV
+struct HalfSpace
+{
+    float minX;
+    bool intersects(const Aabb &box) const { return box.maxX >= minX; }
+    bool contains(const Point &p) const { return p.x() >= minX; }
+};
+
+void test_PointKdTree_nearest_bistatic_matches_bruteforce()
+{
+    auto cloud = randomCloud(30000, 5);
+    // Duplicates of an early point create exact ties; the smaller index must win
+    for (int i = 0; i < 3; ++i)
+    {
+        cloud.addPoint(cloud.getPoints()[10]);
+    }
+    PointKdTree tree(cloud);
+    const auto &points = cloud.getPoints();
+
+    const Point pairs[][2] = {
+        {Point(0.0F, 0.0F, 0.0F), Point(1.0F, 0.5F, 0.0F)},
+        {Point(-20.0F, 5.0F, 1.0F), Point(-18.0F, 7.0F, 1.0F)},
+        {Point(60.0F, 60.0F, 0.0F), Point(61.0F, 60.0F, 0.0F)}};
+    const HalfSpace volumes[] = {{-100.0F}, {0.0F}, {45.0F}};
+
+    for (const auto &pair : pairs)
+    {
+        for (const auto &volume : volumes)
+        {
+            PointKdTree::Nearest expected;
+            for (std::uint32_t i = 0; i < points.size(); ++i)
+            {
+                const float d = points[i].distanceTo(pair[0]) + points[i].distanceTo(pair[1]);
+                if (volume.contains(points[i]) && d < expected.distance)
+                {
+                    expected = {i, d};
+                }
+            }
+
+            const auto found = tree.nearestBistatic(pair[0], pair[1], volume);
+            assert(found.index == expected.index);
+            assert(found.distance == expected.distance);
+
+            // A warm start from any accepted point must not change the answer
+            for (std::uint32_t hint : {0U, 10U, 12345U})
+            {
+                if (!volume.contains(points[hint]))
+                {
+                    continue;
+                }
+                PointKdTree::Nearest seed{hint, points[hint].distanceTo(pair[0]) + points[hint].distanceTo(pair[1])};
+                const auto warm = tree.nearestBistatic(pair[0], pair[1], volume, seed);
+                assert(warm.index == expected.index);
+                assert(warm.distance == expected.distance);
+            }
+        }
+    }
+
+    // Nothing accepted: no result
+    const auto none = tree.nearestBistatic(Point(0.0F, 0.0F, 0.0F), Point(1.0F, 0.0F, 0.0F), HalfSpace{1000.0F});
+    assert(!none.found());
+
+    std::cout << "[PASS] PointKdTree nearest bistatic test\n";
+}
+
+void test_PointKdTree_k_nearest_bistatic_matches_bruteforce()
+{
+    auto cloud = randomCloud(20000, 6);
+    for (int i = 0; i < 3; ++i)
+    {
+        cloud.addPoint(cloud.getPoints()[7]); // exact ties across the k boundary
+    }
+    PointKdTree tree(cloud);
+    const auto &points = cloud.getPoints();
+
+    const Point a(-5.0F, 2.0F, 0.0F);
+    const Point b(-3.0F, 4.0F, 0.5F);
+    for (const auto &volume : {HalfSpace{-100.0F}, HalfSpace{10.0F}, HalfSpace{49.9F}})
+    {
+        std::vector<PointKdTree::Nearest> expected;
+        for (std::uint32_t i = 0; i < points.size(); ++i)
+        {
+            if (volume.contains(points[i]))
+            {
+                expected.push_back({i, points[i].distanceTo(a) + points[i].distanceTo(b)});
+            }
+        }
+        std::sort(expected.begin(), expected.end(), [](const auto &lhs, const auto &rhs)
+                  { return lhs.beats(rhs); });
+
+        for (std::size_t k : {1U, 2U, 4U, 7U})
+        {
+            std::vector<PointKdTree::Nearest> found;
+            tree.kNearestBistatic(a, b, volume, k, found);
+            assert(found.size() == std::min(k, expected.size()));
+            for (std::size_t i = 0; i < found.size(); ++i)
+            {
+                assert(found[i].index == expected[i].index);
+                assert(found[i].distance == expected[i].distance);
+            }
+            if (!found.empty())
+            {
+                assert(found.front().index == tree.nearestBistatic(a, b, volume).index);
+            }
+        }
+    }
+
+    std::vector<PointKdTree::Nearest> none;
+    tree.kNearestBistatic(a, b, HalfSpace{1000.0F}, 4, none);
+    assert(none.empty());
+
+    std::cout << "[PASS] PointKdTree k-nearest bistatic test\n";
+}
+
+void test_PointKdTree_pool_build_matches_sequential()
+{
+    // Large enough to cross the parallel threshold
+    auto cloud = randomCloud(100000, 17);
+    PointKdTree sequential(cloud);
+    core::ThreadPool pool(3);
+    PointKdTree pooled(cloud, &pool);
+
+    const auto &a = sequential.getNodes();
+    const auto &b = pooled.getNodes();
+    assert(a.size() == b.size());
+    for (std::size_t node = 0; node < a.size(); ++node)
+    {
+        assert(a[node].begin == b[node].begin && a[node].end == b[node].end);
+        assert(a[node].bounds.minX == b[node].bounds.minX && a[node].bounds.maxX == b[node].bounds.maxX);
+        assert(a[node].bounds.minY == b[node].bounds.minY && a[node].bounds.maxY == b[node].bounds.maxY);
+        assert(a[node].bounds.minZ == b[node].bounds.minZ && a[node].bounds.maxZ == b[node].bounds.maxZ);
+    }
+
+    std::vector<std::uint32_t> expected;
+    std::vector<std::uint32_t> actual;
+    sequential.radiusSearch(Point(3.0F, -7.0F, 0.0F), 12.0F, expected);
+    pooled.radiusSearch(Point(3.0F, -7.0F, 0.0F), 12.0F, actual);
+    assert(!expected.empty() && expected == actual);
+
+    std::cout << "[PASS] PointKdTree pool build matches sequential build\n";
+}
+
+int main()
+{
+    test_PointKdTree_empty();
+    test_PointKdTree_structure();
+    test_PointKdTree_pool_build_matches_sequential();
+    test_PointKdTree_radius_matches_bruteforce();
+    test_PointKdTree_box_matches_bruteforce();
+    test_PointKdTree_nearest_bistatic_matches_bruteforce();
+    test_PointKdTree_k_nearest_bistatic_matches_bruteforce();
+
+    std::cout << "\n=== All PointKdTree tests passed! ===\n";
+    return 0;
+}
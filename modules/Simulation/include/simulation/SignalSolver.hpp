@@ -2,12 +2,21 @@
 
 #include "SimulationScene.hpp"
 #include <math/math.hpp>
+#include <math/PointKdTree.hpp>
 #include <geometry/implementations/Device.hpp>
 #include <core/Alias.hpp>
+#include <core/FrameArena.hpp>
+#include <core/ThreadPool.hpp>
 
+#include <array>
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <tuple>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <simulation/interfaces/IFrameObserver.hpp>
 #include <simulation/interfaces/ISolver.hpp>
 
@@ -16,49 +25,190 @@ namespace simulation
     class SignalSolver : public ISolver
     {
     public:
-        explicit SignalSolver(std::shared_ptr<SimulationScene> scene);
+        // Outcome of trilaterating one transmitter row
+        enum class TrilaterationStatus : std::uint8_t
+        {
+            Ok,
+            InvalidTof,         // a ToF of the row is missing or ~0
+            ReceiversTooClose,  // receivers 1 and 2 coincide
+            ReceiversCollinear, // receivers 1, 2 and 3 are collinear
+            NoRealSolution      // spheres do not intersect (z^2 < 0)
+        };
+
+        static const char *toString(TrilaterationStatus status);
+
+        // Upper bound for setEchoCount(); k^4 receiver combinations are tried per transmitter
+        static constexpr size_t MAX_ECHOES = 4;
+
+        // workerThreads: threads used for pair solving, counting the caller.
+        // 1 solves sequentially, 0 uses every core. Results do not depend on the count.
+        explicit SignalSolver(std::shared_ptr<SimulationScene> scene, std::size_t workerThreads = 1);
+
+        // Captures the frame cloud and the device frusta for the next solve(). Device poses
+        // live in the scene graph, which is not thread-safe, so call this on the scene's
+        // thread before handing solve() to another one. Without it, solve() captures them itself.
+        void prepare() override;
 
         // Runs the solver and returns closest points for each (Tx, Rx) pair
         std::shared_ptr<math::PointCloud> solve() override;
 
+        // Pair bookkeeping of the last solve() call
+        struct PairStats
+        {
+            size_t searchedPairs = 0; // pairs whose inputs changed and were searched again
+            size_t reusedPairs = 0;   // pairs answered from the previous solve
+        };
+
+        const PairStats &getLastPairStats() const { return lastPairStats_; }
+
+        // Number of echoes (closest points by bistatic range) kept per (Tx, Rx) pair, 1..MAX_ECHOES.
+        // With more than one echo, every consistent combination of one echo per receiver is
+        // trilaterated, so objects hidden behind the closest one can be detected too.
+        void setEchoCount(size_t echoes);
+        size_t getEchoCount() const { return echoCount_; }
+
+        // Arena usage of the last completed solve() (ToF matrix and per-pair flags); the result
+        // cloud and state kept between solves are not counted. Safe to call from any thread.
+        core::FrameArena::Stats getLastArenaStats() const;
+
     private:
         static constexpr size_t REQUIRED_RECEIVER_COUNT = 4;
         static constexpr float EPSILON = 1e-6f;
+        // Slack (in metres) for the echo consistency check between two receivers
+        static constexpr float CONSISTENCY_TOLERANCE = 1e-3f;
+
+        using FrustumList = std::vector<std::shared_ptr<const DeviceFrustum>>;
+        using FlagList = std::pmr::vector<char>;
 
+        // Up to echoCount ToFs per (Tx, Rx) pair, ascending; 0 marks a missing echo
         struct TofMatrix
         {
-            std::vector<std::vector<float>> values;
+            std::pmr::vector<float> values;
             size_t txCount;
             size_t rxCount;
+            size_t echoCount;
 
-            TofMatrix(size_t tx_size, size_t rx_size)
-                : values(tx_size, std::vector<float>(rx_size, 0.0f)), txCount(tx_size), rxCount(rx_size) {}
+            TofMatrix(size_t tx_size, size_t rx_size, size_t echo_count, std::pmr::memory_resource *resource)
+                : values(tx_size * rx_size * echo_count, 0.0f, resource), txCount(tx_size), rxCount(rx_size), echoCount(echo_count) {}
 
-            float &operator()(size_t tx, size_t rx) { return values[tx][rx]; }
-            const float &operator()(size_t tx, size_t rx) const { return values[tx][rx]; }
+            float &operator()(size_t tx, size_t rx, size_t echo = 0) { return values[(tx * rxCount + rx) * echoCount + echo]; }
+            const float &operator()(size_t tx, size_t rx, size_t echo = 0) const { return values[(tx * rxCount + rx) * echoCount + echo]; }
         };
 
+        // Scene state one solve() works on. Frusta are immutable, so the snapshot can be read
+        // from any thread once taken.
+        struct SceneSnapshot
+        {
+            std::shared_ptr<const math::PointCloud> cloud;
+            SharedVec<Device> transmitters;
+            SharedVec<Device> receivers;
+            FrustumList txFrusta;
+            FrustumList rxFrusta;
+        };
+
+        SceneSnapshot captureScene() const;
+
         // Core solving methods
-        std::shared_ptr<math::PointCloud> solveAdsilTrilateration(const TofMatrix &tofMatrix);
+        // One solve(); the ToF matrix and per-pair flags are drawn from arena_
+        std::shared_ptr<math::PointCloud> solveFrame(const SceneSnapshot &scene);
+        std::shared_ptr<math::PointCloud> solveAdsilTrilateration(const SceneSnapshot &scene, const TofMatrix &tofMatrix);
 
-        // Helper methods
-        math::Point findClosestPointInFov(const std::shared_ptr<math::PointCloud> &points,
-                                          const std::shared_ptr<Device> &transmitter,
-                                          const std::shared_ptr<Device> &receiver) const;
+        // What a device contributed to the previous solve. A pair is re-solved only when the
+        // inputs of its transmitter or its receiver changed.
+        struct DeviceInputs
+        {
+            // Devices cache their frustum per pose, FOV and range, so a different frustum
+            // object means the device moved or was reconfigured
+            std::shared_ptr<const DeviceFrustum> frustum;
+            // Order-independent hash of the cloud points inside the frustum, computed on demand
+            // when the cloud changes under an unchanged frustum
+            bool subsetKnown = false;
+            std::uint64_t subsetHash = 0;
+            size_t subsetCount = 0;
+        };
 
-        std::shared_ptr<math::PointCloud> filterPointsByFov(
-            const std::shared_ptr<math::PointCloud> &allPoints,
-            const std::shared_ptr<Device> &transmitter,
-            const std::shared_ptr<Device> &receiver) const;
+        // Result of one (Tx, Rx) pair from the previous solve
+        struct PairResult
+        {
+            bool valid = false; // false until the pair was searched once
+            std::uint32_t winner = math::PointKdTree::NO_INDEX; // cloud index of the closest echo, also a warm-start hint
+            std::array<float, MAX_ECHOES> tofs{}; // bistatic ranges, nearest first
+            size_t echoes = 0;
+        };
+
+        // Helper methods
+        // Fills the ToF of every (Tx, Rx) pair whose shared FOV contains at least one point,
+        // using a branch-and-bound search over the index per pair. Pairs whose devices and
+        // in-FOV points are unchanged since the last solve reuse their previous answer.
+        // Returns the number of pairs with a hit.
+        size_t findClosestPointsPerPair(const SceneSnapshot &scene,
+                                        const std::shared_ptr<const math::PointKdTree> &index,
+                                        TofMatrix &tofMatrix);
 
         bool isValidTofRow(const TofMatrix &tofMatrix, size_t txIndex) const;
 
-        std::pair<math::Point, math::Point> calculateAdsilPositions(
-            const TofMatrix &tofMatrix,
-            size_t txIndex,
-            const SharedVec<Device> &receivers) const;
+        // Coordinate frame spanned by receivers 1..3; depends only on the receiver poses
+        struct ReceiverBasis
+        {
+            TrilaterationStatus status = TrilaterationStatus::Ok;
+            math::Point origin; // receiver 1
+            math::Vector ex, ey, ez;
+            float d = 0.0f; // |c2 - c1|
+            float i = 0.0f; // ex . (c3 - c1)
+            float j = 0.0f; // ey . (c3 - c1)
+            // |rx_a - rx_b|: a single reflector satisfies |tof_a - tof_b| <= baselines[a][b]
+            std::array<std::array<float, REQUIRED_RECEIVER_COUNT>, REQUIRED_RECEIVER_COUNT> baselines{};
+        };
+
+        // Candidate solutions of every transmitter row, as SoA. Row r owns [begin[r], begin[r + 1]):
+        // the two solutions of its first-echo hypothesis, then those of further echo combinations.
+        struct TrilaterationBatch
+        {
+            std::vector<TrilaterationStatus> status; // of the first-echo hypothesis
+            std::vector<size_t> begin;
+            std::vector<float> x, y, z;
+            std::vector<char> inFov;
+        };
+
+        // Returns the basis for the receivers' captured poses, rebuilding it only after a pose change
+        const ReceiverBasis &receiverBasis(const FrustumList &rxFrusta);
+
+        // Solves every row of the matrix against one basis in a single SoA loop. Echo combinations
+        // that a single reflector could not produce are pruned before they are solved.
+        void trilaterateRows(const TofMatrix &tofMatrix, const ReceiverBasis &basis, TrilaterationBatch &batch) const;
+
+        // Runs body(i) for i in [0, count) on the pool, or inline when solving sequentially
+        void runParallel(size_t count, const std::function<void(size_t)> &body);
+
+        // Refreshes cached inputs of each device against its current frustum; changed[d] is set
+        // when pairs involving device d must be searched again
+        void refreshDeviceInputs(const FrustumList &frusta,
+                                 const math::PointCloud &points,
+                                 const math::PointKdTree &index,
+                                 std::vector<DeviceInputs> &inputs,
+                                 FlagList &changed);
 
         std::shared_ptr<SimulationScene> scene_;
+        std::mutex pendingMutex_;
+        std::optional<SceneSnapshot> pending_; // set by prepare(), consumed by the next solve()
+        std::unique_ptr<core::ThreadPool> pool_; // persistent workers; null when sequential
+        // Incremental state from the previous solve (pairs are Tx-major)
+        std::shared_ptr<const math::PointCloud> lastCloud_;
+        std::shared_ptr<const math::PointKdTree> lastIndex_; // identifies the previous frame cloud
+        std::vector<DeviceInputs> txInputs_;
+        std::vector<DeviceInputs> rxInputs_;
+        std::vector<PairResult> pairResults_;
+        PairStats lastPairStats_;
+        size_t echoCount_ = 1;
+        // Transient per-solve storage, reset at the start of every solve (solving thread only)
+        core::FrameArena arena_;
+        mutable std::mutex arenaStatsMutex_;
+        core::FrameArena::Stats lastArenaStats_;
+        ReceiverBasis basis_;
+        // Receiver frusta basis_ was built from; holding them keeps their addresses unique
+        FrustumList basisFrusta_;
+        TrilaterationBatch batch_; // reused across solves
+
         size_t solveCount_ = 0; // For debugging or tracking how many times solve is called
     };
 } // namespace simulation
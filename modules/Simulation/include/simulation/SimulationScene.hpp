@@ -4,6 +4,7 @@
 #include <geometry/interfaces/IShape.hpp>
 #include <geometry/implementations/ShapeBase.hpp>
 #include <math/PointCloud.hpp>
+#include <math/PointKdTree.hpp>
 #include <vehicle/Car.hpp>
 #include <core/Alias.hpp>
 #include <core/Logger.hpp>
@@ -14,14 +15,21 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 
 /**
  * @class SimulationScene
  * @brief Manages the simulation scene containing car, devices, and shapes.
  *
- * @note Thread Safety: This class is NOT thread-safe. All access should be from
- *       a single thread (typically the main/simulation thread). The mutable cache
- *       members are for lazy evaluation optimization in const methods.
+ * Frame clouds are shared, not copied: setExternalPointCloud() swaps the pointer to the
+ * frame's immutable cloud. A reader (e.g. the solver thread) that took the cloud keeps that
+ * frame alive and unchanged for as long as it holds the pointer, even if the frame buffer has
+ * moved on; the next reader simply gets the newer frame.
+ *
+ * @note Thread Safety: The cloud accessors (getMergedPointCloud, getPointIndex,
+ *       setExternalPointCloud, getExternalPointCloud) lock an internal mutex so the solver
+ *       thread can read while the main thread swaps frames. Everything else, including
+ *       shape and car setup, must stay on the main thread.
  */
 class SimulationScene : public ISimulationScene, public simulation::IFrameObserver
 {
@@ -43,15 +51,25 @@ public:
     bool hasCar() const;
 
     // Merged point cloud from all shapes
-    std::shared_ptr<math::PointCloud> getMergedPointCloud(int quality = 2048) const override;
+    std::shared_ptr<const math::PointCloud> getMergedPointCloud(int quality = 2048) const override;
+
+    // Spatial index over getMergedPointCloud(); built lazily once per cloud change and shared
+    // by the solver and any UI code that needs frustum, radius or box queries
+    std::shared_ptr<const math::PointKdTree> getMergedPointIndex(int quality = 2048) const;
+
+    // Index over a cloud previously returned by getMergedPointCloud(); a reader that took
+    // that cloud gets the matching index even if the scene has switched frames since.
+    // The tree is built without holding the cloud mutex, on pool when one is given.
+    std::shared_ptr<const math::PointKdTree> getPointIndex(const std::shared_ptr<const math::PointCloud> &cloud,
+                                                           core::ThreadPool *pool = nullptr) const;
 
     // Timestamp override
     double getTimestamp() const override;
 
     // Inject real data
     void overrideTimestamp(double ts);
-    void setExternalPointCloud(std::shared_ptr<math::PointCloud> cloud);
-    std::shared_ptr<math::PointCloud> getExternalPointCloud() const;
+    void setExternalPointCloud(std::shared_ptr<const math::PointCloud> cloud);
+    std::shared_ptr<const math::PointCloud> getExternalPointCloud() const;
 
     void onFrameChanged(const std::shared_ptr<simulation::Frame> &frame) override;
 
@@ -59,8 +77,9 @@ private:
     std::shared_ptr<Car> car_;
     SharedVec<ShapeBase> shapes_;
 
-    // Real-frame override
-    std::shared_ptr<math::PointCloud> externalCloud_ = std::make_shared<math::PointCloud>();
+    // Real-frame override; guarded by cloudMutex_
+    std::shared_ptr<const math::PointCloud> externalCloud_ = std::make_shared<math::PointCloud>();
+    mutable std::mutex cloudMutex_;
     double timestamp_ = 0.0;
 
     // Internal helper
@@ -71,4 +90,8 @@ private:
     mutable std::shared_ptr<math::PointCloud> mergedCache_;
     mutable bool mergedCacheDirty_ = true;
     mutable int lastQuality_ = -1;
+
+    // Index of the last cloud asked for; keyed by identity, since clouds are never modified
+    mutable std::shared_ptr<const math::PointKdTree> indexCache_;
+    mutable std::shared_ptr<const math::PointCloud> indexCloud_;
 };
@@ -27,6 +27,9 @@ namespace simulation
         struct FrameConfig
         {
             int bufferWindowSize = 3; // ±3 frame window (total = 7)
+            int cacheBudgetMB = 256;  // frames cached beyond the window, least recently used evicted first
+            int prefetchDepth = 8;    // frames loaded ahead in the playback direction
+            int ioThreads = 0;        // background frame loading threads; 0 = one per core (2..8)
         };
 
         // Point cloud configuration
@@ -45,6 +48,19 @@ namespace simulation
             glm::vec3 color = glm::vec3(0.2f, 0.6f, 0.9f);
         };
 
+        // Signal solver configuration
+        struct SolverConfig
+        {
+            int workerThreads = 0; // threads for pair solving; 0 = all cores, 1 = sequential
+            int echoesPerPair = 1; // closest echoes kept per (Tx, Rx) pair, 1..SignalSolver::MAX_ECHOES
+        };
+
+        // Detection export configuration
+        struct ExportConfig
+        {
+            bool binary = false; // .adsdet instead of CSV; ADSIL_EXPORT_FORMAT=binary turns it on
+        };
+
         // Resource configuration
         struct ResourceConfig
         {
@@ -61,6 +77,8 @@ namespace simulation
         const PointCloudConfig &getPointCloudConfig() const { return pointCloudConfig_; }
         const CarConfig &getCarConfig() const { return carConfig_; }
         const ResourceConfig &getResourceConfig() const { return resourceConfig_; }
+        const SolverConfig &getSolverConfig() const { return solverConfig_; }
+        const ExportConfig &getExportConfig() const { return exportConfig_; }
 
         // Setters for runtime configuration
         void setWindowConfig(const WindowConfig &config) { windowConfig_ = config; }
@@ -68,6 +86,8 @@ namespace simulation
         void setPointCloudConfig(const PointCloudConfig &config) { pointCloudConfig_ = config; }
         void setCarConfig(const CarConfig &config) { carConfig_ = config; }
         void setResourceConfig(const ResourceConfig &config) { resourceConfig_ = config; }
+        void setSolverConfig(const SolverConfig &config) { solverConfig_ = config; }
+        void setExportConfig(const ExportConfig &config) { exportConfig_ = config; }
 
     private:
         WindowConfig windowConfig_;
@@ -75,6 +95,8 @@ namespace simulation
         PointCloudConfig pointCloudConfig_;
         CarConfig carConfig_;
         ResourceConfig resourceConfig_;
+        SolverConfig solverConfig_;
+        ExportConfig exportConfig_;
     };
 
 } // namespace simulation
@@ -1,18 +1,24 @@
 #pragma once
 
 #include <math/PointCloud.hpp>
+#include <array>
 #include <vector>
 #include <string>
 #include <memory>
 
 namespace simulation
 {
+    /**
+     * Frames are immutable once loaded: the cloud is shared read-only between the frame cache,
+     * the scene, the solver and the renderer, and lives as long as any of them holds it.
+     */
     struct Frame
     {
-        std::shared_ptr<math::PointCloud> cloud;
+        std::shared_ptr<const math::PointCloud> cloud;
+        int frameId = -1; // -1 when the source did not carry one
         double timestamp = 0.0;
-        // std::vector<float> linearAcceleration; // imu
-        // std::vector<float> angularVelocity;
+        std::array<float, 3> linearAcceleration{}; // imu
+        std::array<float, 3> angularVelocity{};
         std::string filePath;
 
         void clear()
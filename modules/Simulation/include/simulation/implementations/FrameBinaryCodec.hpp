@@ -0,0 +1,73 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <cstddef>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace simulation
+{
+    /**
+     * @class FrameBinaryCodec
+     * @brief Compact binary encoding of a Frame (".adsf" files)
+     *
+     * Layout, all fields little-endian:
+     *
+     *   offset  size  field
+     *        0     4  magic "ADSF"
+     *        4     2  format version (VERSION)
+     *        6     2  header size in bytes (HEADER_SIZE)
+     *        8     4  frame id (int32, -1 if unknown)
+     *       12     4  reserved, 0
+     *       16     8  timestamp (float64, seconds)
+     *       24    12  IMU linear acceleration xyz (float32)
+     *       36    12  IMU angular velocity xyz (float32)
+     *       48     8  point count N (uint64)
+     *       56  12*N  points, packed float32 x, y, z
+     *
+     * A reader checks the magic, the version and that the file holds exactly N points, so a
+     * truncated or foreign file is rejected instead of producing a partial cloud.
+     */
+    class FrameBinaryCodec
+    {
+    public:
+        static constexpr char MAGIC[4] = {'A', 'D', 'S', 'F'};
+        static constexpr std::uint16_t VERSION = 1;
+        static constexpr std::size_t HEADER_SIZE = 56;
+        static constexpr std::size_t POINT_SIZE = 3 * sizeof(float);
+        static constexpr const char *EXTENSION = ".adsf";
+
+        /**
+         * @brief Non-owning view of an encoded frame
+         *
+         * xyz points straight into the encoded bytes (3 floats per point), so the buffer must
+         * outlive the view. Used by FramePack to hand out frames without copying them.
+         */
+        struct View
+        {
+            int frameId = -1;
+            double timestamp = 0.0;
+            std::array<float, 3> linearAcceleration{};
+            std::array<float, 3> angularVelocity{};
+            std::uint64_t pointCount = 0;
+            std::span<const float> xyz;
+        };
+
+        // Serialize to an in-memory buffer / parse one; decode throws std::runtime_error on bad input.
+        // Points are decoded into `storage` (cleared first), so a recycled buffer avoids allocating.
+        static std::vector<std::uint8_t> encode(const Frame &frame);
+        static std::shared_ptr<Frame> decode(const std::uint8_t *data, std::size_t size,
+                                             std::vector<math::Point> storage = {});
+
+        // Validate like decode() without copying; throws if the point data is not 4-byte aligned
+        static View view(const std::uint8_t *data, std::size_t size);
+
+        // File helpers; both throw std::runtime_error on I/O or format errors
+        static void writeFile(const Frame &frame, const std::string &path);
+        static std::shared_ptr<Frame> readFile(const std::string &path, std::vector<math::Point> storage = {});
+    };
+}
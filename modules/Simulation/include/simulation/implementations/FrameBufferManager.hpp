@@ -2,15 +2,17 @@
 
 #include <math/PointCloud.hpp>
 #include <core/ResourceLocator.hpp>
+#include <chrono>
+#include <cstdint>
 #include <functional>
-#include <deque>
 #include <string>
 #include <memory>
-#include <thread>
-#include <mutex>
-#include <atomic>
 #include <simulation/implementations/Frame.hpp>
-#include <adapter/AdapterManager.hpp> // Assuming this loads PointCloud
+#include <simulation/implementations/FrameIndex.hpp>
+#include <simulation/implementations/FramePack.hpp>
+#include <simulation/implementations/FrameCache.hpp>
+#include <simulation/implementations/FramePrefetcher.hpp>
+#include <simulation/implementations/PointBufferPool.hpp>
 #include <simulation/interfaces/IFrameObserver.hpp>
 #include <core/Logger.hpp>
 
@@ -19,64 +21,110 @@ namespace simulation
     class FrameBufferManager
     {
     public:
-        FrameBufferManager(int windowSize = 3);
-
-        void update(float deltaTime); // Called every simulation tick
+        // Time from seek() to the observers seeing the target frame
+        struct SeekStats
+        {
+            std::uint64_t count = 0;
+            double lastMs = 0.0;
+            double maxMs = 0.0;
+            double totalMs = 0.0;
+            double averageMs() const { return count > 0 ? totalMs / static_cast<double>(count) : 0.0; }
+        };
+
+        /**
+         * @param windowSize Frames kept loaded behind the current one (against the playback direction)
+         * @param cacheBudgetBytes Memory budget of the frame cache; frames stay cached beyond the
+         *        window until the budget forces them out, least recently used first
+         * @param prefetchDepth Frames loaded ahead of the current one in the playback direction
+         * @param ioThreads Threads reading frames in the background; FramePrefetcher::AUTO_IO_THREADS
+         *        sizes the pool from the core count and the window
+         */
+        FrameBufferManager(int windowSize = 3, std::size_t cacheBudgetBytes = FrameCache::DEFAULT_BUDGET_BYTES,
+                           int prefetchDepth = 8, std::size_t ioThreads = FramePrefetcher::AUTO_IO_THREADS);
+
+        void update(float deltaTime); // Called every simulation tick; also completes pending seeks
         void play();
         void pause();
         void togglePlayPause();
         bool isPlaying() const { return isPlaying_; }
+        /**
+         * @brief Jump to a frame without blocking on disk
+         *
+         * A cached target is shown at once. Otherwise it is loaded on the I/O threads ahead of
+         * its neighbours, and the next update() after it arrives makes it current and notifies
+         * observers; until then the previous frame stays current and playback waits. A newer
+         * seek or a step replaces a pending one.
+         */
         void seek(int frameId);
+        // seek() to the frame whose timestamp is closest to `timestamp` (seconds)
+        void seekToTimestamp(double timestamp);
+        bool isSeeking() const { return pendingSeek_ >= 0; }
+        int getPendingSeekTarget() const { return pendingSeek_; }
+        SeekStats getSeekStats() const { return seekStats_; }
         void stepForward();
         void stepBackward();
         void setFPS(float fps) { frameInterval_ = 1.0f / fps; }
         float getFPS() const { return 1.0f / frameInterval_; }
 
         void advanceFrame(int direction);
-        void shiftWindow(int direction);
         void notifyObservers();
         bool canAdvance(int direction) const;
 
-        std::shared_ptr<math::PointCloud> getCurrentCloud() const;
+        std::shared_ptr<const math::PointCloud> getCurrentCloud() const;
         double getCurrentTimestamp() const;
         int getCurrentFrameIndex() const { return currentFrameIndex_; }
         int getTotalFrameCount() const { return totalFrameCount_; }
 
         std::shared_ptr<Frame> getCurrentFrame() const;
+        const FrameIndex &getFrameIndex() const { return frameIndex_; }
 
-        // void setOnFrameChanged(std::function<void(int, std::shared_ptr<math::PointCloud>, double)> cb);
+        // void setOnFrameChanged(std::function<void(int, std::shared_ptr<const math::PointCloud>, double)> cb);
 
         void addFrameObserver(const std::shared_ptr<IFrameObserver> &observer);
 
-    private:
-        std::unique_ptr<adapter::AdapterManager> adapters_;
-        std::shared_ptr<Frame> frame_;
+        FrameCache::Stats getCacheStats() const { return cache_.getStats(); }
+        FramePrefetcher::Stats getPrefetchStats() const;
+        std::size_t getIoThreadCount() const { return prefetcher_->getIoThreadCount(); }
+        PointBufferPool::Stats getPointPoolStats() const { return pointPool_->getStats(); }
 
-        std::deque<std::shared_ptr<Frame>> frameWindow_;
+    private:
+        FrameCache cache_;
+        // Point storage of frames that left the cache (and every observer) is reused by later loads
+        std::shared_ptr<PointBufferPool> pointPool_;
+        std::shared_ptr<Frame> currentFrame_;
         std::string frameDir_;
+        // Set when the scene folder holds a frames.adspack; frames then come from its mapping
+        std::shared_ptr<const FramePack> pack_;
+        FrameIndex frameIndex_; // path and timestamp of every frame
         int currentFrameIndex_ = 0;
         int totalFrameCount_ = 0;
 
         int windowSize_;
+        int prefetchDepth_;
+        std::size_t ioThreads_;
+        int playbackDirection_ = +1; // direction of the last step; prefetching follows it
+
+        int pendingSeek_ = -1; // target of a seek still loading, -1 if none
+        std::chrono::steady_clock::time_point seekStart_;
+        SeekStats seekStats_;
         bool isPlaying_ = false;
         float playbackTimer_ = 0.0f;
         float frameInterval_ = 0.10f; // e.g. 10 FPS
 
         std::vector<std::weak_ptr<IFrameObserver>> frameObservers_; // avoid ownership cycle
 
-        std::function<void(int, std::shared_ptr<math::PointCloud>, double)> onFrameChanged_;
+        std::function<void(int, std::shared_ptr<const math::PointCloud>, double)> onFrameChanged_;
 
+        // Makes centerFrame current and prefetches around it in the playback direction
         void loadWindowAround(int centerFrame);
-        std::shared_ptr<Frame> loadFrame(int frameIndex);
+        // Thread-safe: called on the prefetcher's I/O threads
+        std::shared_ptr<Frame> loadFrame(int frameIndex) const;
+        static std::shared_ptr<Frame> readFrameFile(const std::string &path, std::vector<math::Point> storage = {});
         void fireCallback();
+        // Shows the pending seek target once it is cached; drops the seek if its load failed
+        void completePendingSeek();
 
-        // Async frame preloading
-        void startPreloadingNextFrame();
-
-        std::mutex preloadMutex_;
-        std::shared_ptr<Frame> preloadedFrame_;
-        int preloadedFrameIndex_ = -1;
-        std::atomic<bool> preloadInProgress_{false};
-        std::atomic<bool> hasPreloadedFrame_{false};
+        // Last member: destroyed first, so no I/O thread outlives the state it loads from
+        std::unique_ptr<FramePrefetcher> prefetcher_;
     };
 }
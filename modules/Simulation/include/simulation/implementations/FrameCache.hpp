@@ -0,0 +1,79 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace simulation
+{
+    /**
+     * @class FrameCache
+     * @brief Byte-budgeted LRU cache of loaded frames, keyed by frame index
+     *
+     * put() inserts a frame as most recently used and evicts least recently used frames until
+     * the estimated size (see frameBytes()) fits the budget again. The frame just inserted is
+     * never evicted, so a single frame larger than the budget is still served. Evicting only
+     * drops the cache's reference; observers still holding the frame keep it alive.
+     *
+     * @note Thread Safety: All methods lock an internal mutex, so loader threads may insert
+     *       while the render thread reads.
+     */
+    class FrameCache
+    {
+    public:
+        static constexpr std::size_t DEFAULT_BUDGET_BYTES = 256u * 1024u * 1024u;
+
+        struct Stats
+        {
+            std::uint64_t hits = 0;
+            std::uint64_t misses = 0;
+            std::uint64_t evictions = 0;
+            std::size_t entries = 0;
+            std::size_t bytes = 0;
+            std::size_t budgetBytes = 0;
+        };
+
+        explicit FrameCache(std::size_t budgetBytes = DEFAULT_BUDGET_BYTES) : budgetBytes_(budgetBytes) {}
+
+        FrameCache(const FrameCache &) = delete;
+        FrameCache &operator=(const FrameCache &) = delete;
+
+        // Cached frame (marked most recently used), or nullptr; counts a hit or a miss
+        std::shared_ptr<Frame> get(int index);
+
+        // Like get() but neither reorders nor counts; for "is it loaded yet?" checks
+        bool contains(int index) const;
+
+        void put(int index, std::shared_ptr<Frame> frame);
+        void setBudget(std::size_t budgetBytes);
+        void clear();
+
+        Stats getStats() const;
+
+        // Estimated memory held by a frame: the struct, its points and its path string
+        static std::size_t frameBytes(const Frame &frame);
+
+    private:
+        struct Entry
+        {
+            int index;
+            std::shared_ptr<Frame> frame;
+            std::size_t bytes;
+        };
+        using EntryList = std::list<Entry>;
+
+        // Caller holds mutex_; keeps at least `keep` entries
+        void evictToBudget(std::size_t keep);
+
+        mutable std::mutex mutex_;
+        EntryList entries_; // front = most recently used
+        std::unordered_map<int, EntryList::iterator> lookup_;
+        std::size_t bytes_ = 0;
+        std::size_t budgetBytes_;
+        Stats stats_;
+    };
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <simulation/implementations/FramePack.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simulation
+{
+    /**
+     * @class FrameIndex
+     * @brief Per-frame metadata of a recording: where each frame lives and when it was taken
+     *
+     * For a folder of frame_XXXXX.json / .adsf files the index is kept in a sidecar file
+     * (SIDECAR_FILE_NAME) next to the frames, so startup reads one small file instead of
+     * parsing every frame. The sidecar is trusted only while the folder's mtime and every
+     * frame file's size and mtime match what was recorded; otherwise the frames are parsed
+     * once more and the sidecar is rewritten. A frame pack carries the same data in its own
+     * index, so fromPack() needs no sidecar.
+     *
+     * Sidecar layout, little-endian: magic "ADSFIDX\0", version (uint32), reserved (uint32),
+     * frame count (uint64), folder mtime (int64), then per frame: file name length (uint16),
+     * file name, byte offset (uint64), byte size (uint64), mtime (int64), point count (uint64),
+     * timestamp (float64), frame id (int32).
+     */
+    class FrameIndex
+    {
+    public:
+        static constexpr char MAGIC[8] = {'A', 'D', 'S', 'F', 'I', 'D', 'X', '\0'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr const char *SIDECAR_FILE_NAME = "frames.adsidx";
+
+        struct Entry
+        {
+            std::string path;         // full path of the file holding the frame
+            std::uint64_t offset = 0; // where the frame starts in that file (non-zero in packs)
+            std::uint64_t byteSize = 0;
+            std::int64_t mtime = 0; // file mtime, file_clock ticks; 0 for pack frames
+            std::uint64_t pointCount = 0;
+            double timestamp = 0.0;
+            int frameId = -1;
+        };
+
+        using FileLoader = std::function<std::shared_ptr<Frame>(const std::string &)>;
+
+        static FrameIndex fromPack(const FramePack &pack);
+
+        /**
+         * @brief Index of the frame_* files in frameDir, from the sidecar when it is current
+         *
+         * On a rebuild every frame is read through loader (in parallel) and the sidecar is
+         * written; a folder that cannot be written to only costs a warning. A frame the loader
+         * throws on is left out of the index with a warning, and the sidecar is not written
+         * so it is retried next time.
+         */
+        static FrameIndex loadOrBuild(const std::string &frameDir, const FileLoader &loader);
+
+        std::size_t size() const { return entries_.size(); }
+        bool empty() const { return entries_.empty(); }
+        const Entry &entry(std::size_t index) const { return entries_.at(index); }
+        const std::vector<Entry> &entries() const { return entries_; }
+
+        // True when loadOrBuild() could use the sidecar as it was
+        bool isFromSidecar() const { return fromSidecar_; }
+
+        /**
+         * @brief Index of the frame whose timestamp is closest to `timestamp`, -1 if empty
+         *
+         * Binary search over the timestamps when they are in order (the normal case), a linear
+         * scan otherwise.
+         */
+        int findNearest(double timestamp) const;
+
+    private:
+        void finalize(); // checks timestamp order
+
+        std::vector<Entry> entries_;
+        bool timestampsSorted_ = true;
+        bool fromSidecar_ = false;
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <utils/MappedFile.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace simulation
+{
+    /**
+     * @class FramePack
+     * @brief Read-only, memory-mapped recording of many frames in one ".adspack" file
+     *
+     * Layout, all fields little-endian:
+     *
+     *   file header (16 bytes)  magic "ADSPACK\0", format version (uint32), reserved (uint32)
+     *   frames                  one ADSF frame each (see FrameBinaryCodec), padded to 16 bytes
+     *   index (32 bytes/frame)  offset (uint64), size (uint64), timestamp (float64),
+     *                           frame id (int32), reserved (uint32)
+     *   trailer (24 bytes)      index offset (uint64), frame count (uint64), magic "ADSPIDX\0"
+     *
+     * open() maps the file and validates the trailer and every index entry, so frame i is one
+     * lookup away and never reads out of range. view() hands out the mapped bytes as they are;
+     * loadFrame() copies them into a Frame.
+     *
+     * @note Thread Safety: Immutable after open(); view(), loadFrame() and the accessors may be
+     *       called from any number of threads.
+     */
+    class FramePack
+    {
+    public:
+        static constexpr char MAGIC[8] = {'A', 'D', 'S', 'P', 'A', 'C', 'K', '\0'};
+        static constexpr char INDEX_MAGIC[8] = {'A', 'D', 'S', 'P', 'I', 'D', 'X', '\0'};
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::size_t HEADER_SIZE = 16;
+        static constexpr std::size_t INDEX_ENTRY_SIZE = 32;
+        static constexpr std::size_t TRAILER_SIZE = 24;
+        static constexpr std::size_t ALIGNMENT = 16;
+        static constexpr const char *EXTENSION = ".adspack";
+        static constexpr const char *DEFAULT_FILE_NAME = "frames.adspack";
+
+        struct IndexEntry
+        {
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;
+            double timestamp = 0.0;
+            std::int32_t frameId = -1;
+        };
+
+        // Throws std::runtime_error if the file cannot be mapped or is not a valid pack
+        static std::unique_ptr<FramePack> open(const std::string &path);
+
+        std::size_t frameCount() const { return index_.size(); }
+        double timestamp(std::size_t index) const { return entry(index).timestamp; }
+        int frameId(std::size_t index) const { return entry(index).frameId; }
+        const std::string &getPath() const { return file_.getPath(); }
+
+        // Where frame `index` sits in the file; throws std::out_of_range for a bad index
+        const IndexEntry &entry(std::size_t index) const;
+
+        // Zero-copy view into the mapping; valid while this pack is alive
+        FrameBinaryCodec::View view(std::size_t index) const;
+
+        // Materialize frame `index` into `storage`, with filePath set to "<pack path>#<index>"
+        std::shared_ptr<Frame> loadFrame(std::size_t index, std::vector<math::Point> storage = {}) const;
+
+    private:
+        explicit FramePack(utils::MappedFile file) : file_(std::move(file)) {}
+
+        utils::MappedFile file_;
+        std::vector<IndexEntry> index_;
+    };
+
+    /**
+     * @class FramePackWriter
+     * @brief Streams frames into a new ".adspack" file
+     *
+     * Frames are written as they are appended; finish() writes the index and trailer. A pack
+     * whose writer never finished has no trailer and is rejected by FramePack::open().
+     * All methods throw std::runtime_error on I/O errors.
+     */
+    class FramePackWriter
+    {
+    public:
+        explicit FramePackWriter(const std::string &path);
+
+        void append(const Frame &frame);
+        void finish();
+
+        std::size_t frameCount() const { return index_.size(); }
+
+    private:
+        void write(const void *data, std::size_t size);
+
+        std::string path_;
+        std::ofstream file_;
+        std::uint64_t offset_ = 0;
+        std::vector<FramePack::IndexEntry> index_;
+        bool finished_ = false;
+    };
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <simulation/implementations/Frame.hpp>
+#include <simulation/implementations/FrameCache.hpp>
+#include <core/ThreadPool.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace simulation
+{
+    /**
+     * @class FramePrefetcher
+     * @brief Loads upcoming frames into a FrameCache on a fixed pool of I/O threads
+     *
+     * request(center, direction) replaces the wanted set with the next lookAhead frames in the
+     * playback direction (optionally preceded by the centre itself), followed by lookBehind frames on the other side. Frames that are
+     * neither cached nor already queued are handed to the pool, nearest first. A queued frame
+     * that dropped out of the wanted set (e.g. after a seek) is cancelled when its turn comes
+     * instead of being read.
+     *
+     * acquire(index) is the render thread's way in: it returns the cached frame, waits for an
+     * in-flight load of that frame, or loads it synchronously. The last two count as stalls.
+     * Issuing request() before acquire() lets the neighbours load on the pool while the caller
+     * loads the centre, so a whole window takes about as long as its slowest frame as long as
+     * there are enough I/O threads.
+     *
+     * Loads share no parser state (every load builds its own), so the threads never serialize
+     * on each other apart from the short bookkeeping under the mutex.
+     *
+     * @note Thread Safety: request(), acquire() and getStats() may be called from any thread.
+     *       The loader runs on the I/O threads and must be thread-safe.
+     */
+    class FramePrefetcher
+    {
+    public:
+        using Loader = std::function<std::shared_ptr<Frame>(int)>;
+
+        // Passed as ioThreads: one thread per core, at least 2, at most MAX_AUTO_IO_THREADS,
+        // and never more than the frames one request can ask for
+        static constexpr std::size_t AUTO_IO_THREADS = 0;
+        static constexpr std::size_t MAX_AUTO_IO_THREADS = 8;
+
+        struct Stats
+        {
+            std::size_t queueDepth = 0; // requests waiting for an I/O thread
+            std::size_t inFlight = 0;   // frames being read right now
+            std::uint64_t requested = 0;
+            std::uint64_t completed = 0;
+            std::uint64_t cancelled = 0; // dropped before reading: no longer wanted, or cached meanwhile
+            std::uint64_t failures = 0;
+            std::uint64_t stalls = 0; // acquire() calls that had to wait for I/O
+        };
+
+        FramePrefetcher(FrameCache &cache, Loader loader, int frameCount, int lookAhead, int lookBehind,
+                        std::size_t ioThreads = AUTO_IO_THREADS);
+        ~FramePrefetcher();
+
+        FramePrefetcher(const FramePrefetcher &) = delete;
+        FramePrefetcher &operator=(const FramePrefetcher &) = delete;
+
+        // direction is +1 or -1; the centre itself is queued first only with includeCenter, as
+        // callers usually acquire() it right away
+        void request(int center, int direction, bool includeCenter = false);
+
+        // True while the frame is queued or being read
+        bool isPending(int index) const;
+
+        // True when the last prefetch of the frame threw; cleared when it is queued again
+        bool hasFailed(int index) const;
+
+        std::shared_ptr<Frame> acquire(int index);
+
+        Stats getStats() const;
+        std::size_t getIoThreadCount() const { return pool_.getWorkerCount(); }
+
+        static std::size_t resolveIoThreads(std::size_t requested, int lookAhead, int lookBehind);
+
+    private:
+        void loadTask(int index);
+
+        FrameCache &cache_;
+        Loader loader_;
+        const int frameCount_;
+        const int lookAhead_;
+        const int lookBehind_;
+
+        mutable std::mutex mutex_;
+        std::condition_variable loaded_;
+        std::unordered_set<int> wanted_;
+        std::unordered_set<int> queued_;
+        std::unordered_set<int> inFlight_;
+        std::unordered_set<int> failed_;
+        Stats stats_;
+
+        // Last member: its destructor drains the queue while everything above is still alive
+        core::ThreadPool pool_;
+    };
+}
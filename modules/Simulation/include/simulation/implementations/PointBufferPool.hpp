@@ -0,0 +1,72 @@
+#pragma once
+
+#include <math/Point.hpp>
+#include <math/PointCloud.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace simulation
+{
+    /**
+     * @class PointBufferPool
+     * @brief Recycles point storage between frame loads
+     *
+     * acquire() hands out an empty point vector with room for at least the requested number of
+     * points, reusing the smallest pooled buffer that is large enough; buffers it has to create or
+     * grow are sized for the largest request so far. share() wraps a filled
+     * cloud in a shared_ptr whose deleter gives the storage back to the pool once the last
+     * holder (cache, observers, ...) lets go of the cloud. Once the pool has warmed up, loading
+     * frames of similar size allocates no point storage at all.
+     *
+     * At most maxBuffers buffers are kept; storage returned to a full pool is freed. Clouds may
+     * outlive the pool, their storage is then simply freed.
+     *
+     * Always create the pool with std::make_shared: share() needs shared_from_this().
+     *
+     * @note Thread Safety: All methods lock an internal mutex; loader threads and the render
+     *       thread may use the pool concurrently.
+     */
+    class PointBufferPool : public std::enable_shared_from_this<PointBufferPool>
+    {
+    public:
+        static constexpr std::size_t DEFAULT_MAX_BUFFERS = 16;
+
+        struct Stats
+        {
+            std::uint64_t reused = 0;    // acquire() served from the pool without allocating
+            std::uint64_t grown = 0;     // acquire() took a pooled buffer that had to grow
+            std::uint64_t allocated = 0; // acquire() found the pool empty
+            std::uint64_t recycled = 0;  // storage returned to the pool
+            std::uint64_t dropped = 0;   // storage freed because the pool was full
+            std::size_t pooledBuffers = 0;
+            std::size_t pooledBytes = 0;
+        };
+
+        explicit PointBufferPool(std::size_t maxBuffers = DEFAULT_MAX_BUFFERS) : maxBuffers_(maxBuffers) {}
+
+        PointBufferPool(const PointBufferPool &) = delete;
+        PointBufferPool &operator=(const PointBufferPool &) = delete;
+
+        // Empty vector with capacity for at least pointCount points
+        std::vector<math::Point> acquire(std::size_t pointCount);
+
+        // Takes over cloud's points; they return to the pool when the shared cloud is destroyed
+        std::shared_ptr<const math::PointCloud> share(math::PointCloud &&cloud);
+
+        // Gives storage back directly; normally done by the deleter of share()
+        void recycle(std::vector<math::Point> &&points);
+
+        void clear();
+        Stats getStats() const;
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<std::vector<math::Point>> buffers_;
+        std::size_t maxBuffers_;
+        std::size_t largestRequest_ = 0;
+        Stats stats_;
+    };
+}
@@ -4,7 +4,7 @@ class PointCloudScene : public ISimulationScene
 {
 public:
     explicit PointCloudScene(const std::string &jsonPath);
-    std::shared_ptr<math::PointCloud> getMergedPointCloud(int quality = 2048) const override;
+    std::shared_ptr<const math::PointCloud> getMergedPointCloud(int quality = 2048) const override;
     double getTimestamp() const override;
 
 private:
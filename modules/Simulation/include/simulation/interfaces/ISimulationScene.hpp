@@ -7,8 +7,8 @@ class ISimulationScene
 public:
     virtual ~ISimulationScene() = default;
 
-    // Main data source for the simulation
-    virtual std::shared_ptr<math::PointCloud> getMergedPointCloud(int quality = 2048) const = 0;
+    // Main data source for the simulation; read-only and shared, callers keep it alive as needed
+    virtual std::shared_ptr<const math::PointCloud> getMergedPointCloud(int quality = 2048) const = 0;
 
     // Time tagging (used for timeline, logging, etc.)
     virtual double getTimestamp() const = 0;
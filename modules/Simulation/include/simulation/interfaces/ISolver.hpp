@@ -10,6 +10,11 @@ namespace simulation
     public:
         virtual ~ISolver() = default;
 
+        // Capture the scene state solve() needs (e.g. device poses) on the thread that owns
+        // the scene graph. Call it before running solve() on another thread; solvers that
+        // read nothing thread-affine can ignore it.
+        virtual void prepare() {}
+
         // Run the solver for the current scene state and return detected point cloud
         virtual std::shared_ptr<math::PointCloud> solve() = 0;
     };
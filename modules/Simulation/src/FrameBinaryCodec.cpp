@@ -0,0 +1,153 @@
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <utils/MappedFile.hpp>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace simulation
+{
+    // The payload is copied in host order; a big-endian port needs byte swapping here
+    static_assert(std::endian::native == std::endian::little, "FrameBinaryCodec assumes a little-endian host");
+
+    namespace
+    {
+        template <typename T>
+        void put(std::uint8_t *out, std::size_t offset, const T &value)
+        {
+            std::memcpy(out + offset, &value, sizeof(T));
+        }
+
+        template <typename T>
+        T get(const std::uint8_t *in, std::size_t offset)
+        {
+            T value;
+            std::memcpy(&value, in + offset, sizeof(T));
+            return value;
+        }
+    } // namespace
+
+    std::vector<std::uint8_t> FrameBinaryCodec::encode(const Frame &frame)
+    {
+        const std::size_t count = frame.cloud ? frame.cloud->size() : 0;
+        std::vector<std::uint8_t> out(HEADER_SIZE + count * POINT_SIZE, 0);
+        std::uint8_t *data = out.data();
+
+        std::memcpy(data, MAGIC, sizeof(MAGIC));
+        put<std::uint16_t>(data, 4, VERSION);
+        put<std::uint16_t>(data, 6, static_cast<std::uint16_t>(HEADER_SIZE));
+        put<std::int32_t>(data, 8, frame.frameId);
+        put<double>(data, 16, frame.timestamp);
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            put<float>(data, 24 + axis * sizeof(float), frame.linearAcceleration[axis]);
+            put<float>(data, 36 + axis * sizeof(float), frame.angularVelocity[axis]);
+        }
+        put<std::uint64_t>(data, 48, count);
+
+        std::size_t offset = HEADER_SIZE;
+        for (std::size_t i = 0; i < count; ++i, offset += POINT_SIZE)
+        {
+            const auto &p = frame.cloud->getPoints()[i];
+            const float xyz[3] = {p.x(), p.y(), p.z()};
+            std::memcpy(data + offset, xyz, POINT_SIZE);
+        }
+        return out;
+    }
+
+    namespace
+    {
+        // Validates the header and size; fills everything but xyz and returns the payload offset
+        std::size_t readHeader(const std::uint8_t *data, std::size_t size, FrameBinaryCodec::View &out)
+        {
+            if (size < FrameBinaryCodec::HEADER_SIZE || std::memcmp(data, FrameBinaryCodec::MAGIC, sizeof(FrameBinaryCodec::MAGIC)) != 0)
+            {
+                throw std::runtime_error("FrameBinaryCodec: not an ADSF frame");
+            }
+            if (get<std::uint16_t>(data, 4) != FrameBinaryCodec::VERSION)
+            {
+                throw std::runtime_error("FrameBinaryCodec: unsupported format version " + std::to_string(get<std::uint16_t>(data, 4)));
+            }
+
+            const std::size_t headerSize = get<std::uint16_t>(data, 6);
+            const std::uint64_t count = get<std::uint64_t>(data, 48);
+            constexpr std::size_t pointSize = FrameBinaryCodec::POINT_SIZE;
+            if (headerSize < FrameBinaryCodec::HEADER_SIZE || headerSize > size || (size - headerSize) / pointSize != count ||
+                (size - headerSize) % pointSize != 0)
+            {
+                throw std::runtime_error("FrameBinaryCodec: point count does not match the file size");
+            }
+
+            out.frameId = get<std::int32_t>(data, 8);
+            out.timestamp = get<double>(data, 16);
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                out.linearAcceleration[axis] = get<float>(data, 24 + axis * sizeof(float));
+                out.angularVelocity[axis] = get<float>(data, 36 + axis * sizeof(float));
+            }
+            out.pointCount = count;
+            return headerSize;
+        }
+    } // namespace
+
+    FrameBinaryCodec::View FrameBinaryCodec::view(const std::uint8_t *data, std::size_t size)
+    {
+        View view;
+        const std::uint8_t *points = data + readHeader(data, size, view);
+        if (reinterpret_cast<std::uintptr_t>(points) % alignof(float) != 0)
+        {
+            throw std::runtime_error("FrameBinaryCodec: point data is not aligned for in-place access");
+        }
+        view.xyz = std::span<const float>(reinterpret_cast<const float *>(points), static_cast<std::size_t>(view.pointCount) * 3);
+        return view;
+    }
+
+    std::shared_ptr<Frame> FrameBinaryCodec::decode(const std::uint8_t *data, std::size_t size, std::vector<math::Point> storage)
+    {
+        View header;
+        const std::size_t headerSize = readHeader(data, size, header);
+
+        auto frame = std::make_shared<Frame>();
+        frame->frameId = header.frameId;
+        frame->timestamp = header.timestamp;
+        frame->linearAcceleration = header.linearAcceleration;
+        frame->angularVelocity = header.angularVelocity;
+
+        // memcpy per point: the buffer may not be float-aligned
+        std::vector<math::Point> points = std::move(storage);
+        points.clear();
+        points.reserve(static_cast<std::size_t>(header.pointCount));
+        for (const std::uint8_t *p = data + headerSize; p != data + size; p += POINT_SIZE)
+        {
+            float xyz[3];
+            std::memcpy(xyz, p, POINT_SIZE);
+            points.emplace_back(xyz[0], xyz[1], xyz[2]);
+        }
+        frame->cloud = std::make_shared<math::PointCloud>(std::move(points));
+        return frame;
+    }
+
+    void FrameBinaryCodec::writeFile(const Frame &frame, const std::string &path)
+    {
+        const auto bytes = encode(frame);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            throw std::runtime_error("FrameBinaryCodec: cannot open " + path + " for writing");
+        }
+        file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file)
+        {
+            throw std::runtime_error("FrameBinaryCodec: failed to write " + path);
+        }
+    }
+
+    std::shared_ptr<Frame> FrameBinaryCodec::readFile(const std::string &path, std::vector<math::Point> storage)
+    {
+        // Decode straight out of the mapping: no intermediate copy of the file
+        const utils::MappedFile file(path);
+        auto frame = decode(file.data(), file.size(), std::move(storage));
+        frame->filePath = path;
+        return frame;
+    }
+}
@@ -1,41 +1,70 @@
 #include <simulation/implementations/FrameBufferManager.hpp>
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <adapter/implementations/FrameJsonStreamParser.hpp>
 #include <math/PointCloud.hpp>
+#include <algorithm>
 #include <filesystem>
-#include <sstream>
-#include <iomanip>
 #include <iostream>
-#include <thread>
 
 namespace simulation
 {
     namespace fs = std::filesystem;
 
-    FrameBufferManager::FrameBufferManager(int windowSize)
-        : frameDir_(core::ResourceLocator::getJsonPathForScene("")),
+    FrameBufferManager::FrameBufferManager(int windowSize, std::size_t cacheBudgetBytes, int prefetchDepth, std::size_t ioThreads)
+        : cache_(cacheBudgetBytes),
+          pointPool_(std::make_shared<PointBufferPool>()),
+          frameDir_(core::ResourceLocator::getJsonPathForScene("")),
           windowSize_(windowSize),
+          prefetchDepth_(prefetchDepth),
+          ioThreads_(ioThreads),
           currentFrameIndex_(0),
           totalFrameCount_(0),
           isPlaying_(false),
           frameInterval_(0.10f), // ~10Hz
           playbackTimer_(0.0f)
     {
-        adapters_ = std::make_unique<adapter::AdapterManager>();
+        // A frame pack replaces the per-frame files: its own index gives counts and timestamps
+        const std::string packPath = core::ResourceLocator::getJsonPathForScene(FramePack::DEFAULT_FILE_NAME);
+        if (fs::exists(packPath))
+        {
+            try
+            {
+                pack_ = FramePack::open(packPath);
+                frameIndex_ = FrameIndex::fromPack(*pack_);
+                LOGGER_INFO("FrameBufferManager", "Using frame pack " + packPath + " (" + std::to_string(frameIndex_.size()) + " frames)");
+            }
+            catch (const std::exception &e)
+            {
+                LOGGER_WARN("Ignoring frame pack: " + std::string(e.what()));
+                pack_.reset();
+            }
+        }
 
-        // Count files in folder that match frame_XXXXX.json
-        for (const auto &entry : fs::directory_iterator(frameDir_))
+        if (!pack_)
         {
-            if (entry.is_regular_file() && entry.path().extension() == ".json")
-                ++totalFrameCount_;
+            // Reads the sidecar index when it is current; parses every frame only on a change
+            frameIndex_ = FrameIndex::loadOrBuild(frameDir_, [](const std::string &path)
+                                                  { return readFrameFile(path); });
         }
+        totalFrameCount_ = static_cast<int>(frameIndex_.size());
 
-        loadWindowAround(currentFrameIndex_);
+        prefetcher_ = std::make_unique<FramePrefetcher>(
+            cache_, [this](int index)
+            { return loadFrame(index); },
+            totalFrameCount_, prefetchDepth_, windowSize_, ioThreads_);
 
-        // Start preloading the next frame
-        startPreloadingNextFrame();
+        loadWindowAround(currentFrameIndex_);
     }
 
     void FrameBufferManager::update(float deltaTime)
     {
+        if (pendingSeek_ >= 0)
+        {
+            completePendingSeek();
+            if (pendingSeek_ >= 0)
+                return; // playback resumes from the seek target
+        }
+
         if (!isPlaying_ || totalFrameCount_ == 0)
             return;
 
@@ -63,9 +92,46 @@ namespace simulation
         if (frameId < 0 || frameId >= totalFrameCount_)
             return;
 
-        currentFrameIndex_ = frameId;
+        pendingSeek_ = frameId;
+        seekStart_ = std::chrono::steady_clock::now();
+        prefetcher_->request(frameId, playbackDirection_, true);
+        completePendingSeek(); // immediate when the target is cached
+    }
+
+    void FrameBufferManager::seekToTimestamp(double timestamp)
+    {
+        seek(frameIndex_.findNearest(timestamp));
+    }
+
+    void FrameBufferManager::completePendingSeek()
+    {
+        const int target = pendingSeek_;
+        // Pending is checked first: a load caches its frame before it stops being pending
+        if (prefetcher_->isPending(target))
+            return;
+        if (!cache_.contains(target))
+        {
+            if (prefetcher_->hasFailed(target))
+            {
+                LOGGER_WARN("Seek to frame " + std::to_string(target) + " abandoned: frame could not be loaded");
+                pendingSeek_ = -1;
+                return;
+            }
+            // Loaded but already evicted by its neighbours, or cancelled by a newer request
+            prefetcher_->request(target, playbackDirection_, true);
+            return;
+        }
+
+        pendingSeek_ = -1;
+        currentFrameIndex_ = target;
         loadWindowAround(currentFrameIndex_);
         fireCallback();
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - seekStart_).count();
+        seekStats_.count++;
+        seekStats_.lastMs = ms;
+        seekStats_.totalMs += ms;
+        seekStats_.maxMs = std::max(seekStats_.maxMs, ms);
     }
 
     bool FrameBufferManager::canAdvance(int direction) const
@@ -76,13 +142,13 @@ namespace simulation
 
     void FrameBufferManager::notifyObservers()
     {
-        if (frameWindow_.empty())
+        if (!currentFrame_)
         {
-            LOGGER_WARN("Frame window is empty, cannot notify observers.");
+            LOGGER_WARN_EVERY_MS(1000, "No current frame, cannot notify observers.");
             return;
         }
 
-        const auto &frame = frameWindow_[windowSize_];
+        const auto &frame = currentFrame_;
 
         if (onFrameChanged_)
             onFrameChanged_(currentFrameIndex_, frame->cloud, frame->timestamp);
@@ -102,52 +168,6 @@ namespace simulation
         }
     }
 
-    void FrameBufferManager::shiftWindow(int direction)
-    {
-        if (direction == +1)
-        {
-            if (!frameWindow_.empty() && frameWindow_.front())
-                frameWindow_.front()->clear();
-            frameWindow_.pop_front();
-
-            int newFrameIndex = currentFrameIndex_ + windowSize_;
-            if (newFrameIndex < totalFrameCount_)
-            {
-                // Try to use preloaded frame if available
-                if (hasPreloadedFrame_.load() && preloadedFrameIndex_ == newFrameIndex)
-                {
-                    std::lock_guard<std::mutex> lock(preloadMutex_);
-                    frameWindow_.push_back(preloadedFrame_);
-                    preloadedFrame_.reset();
-                    hasPreloadedFrame_.store(false);
-                }
-                else
-                {
-                    frameWindow_.push_back(loadFrame(newFrameIndex));
-                }
-            }
-            else
-            {
-                frameWindow_.push_back(std::make_shared<Frame>());
-            }
-
-            // Start preloading the next frame in background
-            startPreloadingNextFrame();
-        }
-        else if (direction == -1)
-        {
-            if (!frameWindow_.empty() && frameWindow_.back())
-                frameWindow_.back()->clear();
-            frameWindow_.pop_back();
-
-            int newFrameIndex = currentFrameIndex_ - windowSize_;
-            if (newFrameIndex >= 0)
-                frameWindow_.push_front(loadFrame(newFrameIndex));
-            else
-                frameWindow_.push_front(std::make_shared<Frame>());
-        }
-    }
-
     void FrameBufferManager::advanceFrame(int direction)
     {
         currentFrameIndex_ += direction;
@@ -157,8 +177,10 @@ namespace simulation
     {
         if (canAdvance(+1))
         {
+            pendingSeek_ = -1;
             advanceFrame(+1);
-            shiftWindow(+1);
+            playbackDirection_ = +1;
+            loadWindowAround(currentFrameIndex_);
             notifyObservers();
         }
     }
@@ -167,71 +189,81 @@ namespace simulation
     {
         if (canAdvance(-1))
         {
+            pendingSeek_ = -1;
             advanceFrame(-1);
-            shiftWindow(-1);
+            playbackDirection_ = -1;
+            loadWindowAround(currentFrameIndex_);
             notifyObservers();
         }
     }
 
-    std::shared_ptr<math::PointCloud> FrameBufferManager::getCurrentCloud() const
+    std::shared_ptr<const math::PointCloud> FrameBufferManager::getCurrentCloud() const
     {
-        if (!frameWindow_.empty())
-            return frameWindow_[windowSize_]->cloud;
+        if (currentFrame_)
+            return currentFrame_->cloud;
         return nullptr;
     }
 
     double FrameBufferManager::getCurrentTimestamp() const
     {
-        if (!frameWindow_.empty())
-            return frameWindow_[windowSize_]->timestamp;
+        if (currentFrame_)
+            return currentFrame_->timestamp;
         return 0.0;
     }
 
     void FrameBufferManager::loadWindowAround(int centerFrame)
     {
-        // Step 1: Clear internal data of each frame before dropping references
-        for (auto &frame : frameWindow_)
+        if (centerFrame < 0 || centerFrame >= totalFrameCount_)
         {
-            if (frame)
-                frame->clear();
+            currentFrame_.reset();
+            return;
         }
 
-        frameWindow_.clear();
-        for (int offset = -windowSize_; offset <= windowSize_; ++offset)
-        {
-            int index = centerFrame + offset;
-            if (index < 0 || index >= totalFrameCount_)
-            {
-                frameWindow_.emplace_back(std::make_shared<Frame>());
-            }
-            else
-            {
-                frameWindow_.emplace_back(loadFrame(index));
-            }
-        }
+        // Neighbours are queued first so the I/O threads read them while this thread reads the
+        // centre; only the centre is waited for. Frames that fall behind stay in the cache until
+        // the budget evicts them.
+        prefetcher_->request(centerFrame, playbackDirection_);
+        currentFrame_ = prefetcher_->acquire(centerFrame);
     }
 
-    std::shared_ptr<Frame> FrameBufferManager::loadFrame(int index)
+    FramePrefetcher::Stats FrameBufferManager::getPrefetchStats() const
     {
-        std::ostringstream filename;
-        filename << "frame_" << std::setw(5) << std::setfill('0') << index << ".json";
+        return prefetcher_->getStats();
+    }
 
-        std::string path = core::ResourceLocator::getJsonPathForScene(filename.str());
-        auto frame = adapters_->fromJson<std::shared_ptr<simulation::Frame>>(path);
+    std::shared_ptr<Frame> FrameBufferManager::loadFrame(int index) const
+    {
+        // The index knows the point count, so the recycled buffer is sized before parsing
+        const auto &entry = frameIndex_.entry(static_cast<std::size_t>(index));
+        auto storage = pointPool_->acquire(static_cast<std::size_t>(entry.pointCount));
 
-        frame->filePath = path; // filePath JSON'da yoksa burada setlenir
+        auto frame = pack_ ? pack_->loadFrame(static_cast<std::size_t>(index), std::move(storage))
+                           : readFrameFile(entry.path, std::move(storage));
+        if (frame->cloud)
+        {
+            // The loader just built this cloud (non-const) and nothing else holds it yet, so its
+            // storage can be moved into a pooled cloud before the frame is published
+            auto loaded = std::const_pointer_cast<math::PointCloud>(std::move(frame->cloud));
+            frame->cloud = pointPool_->share(std::move(*loaded));
+        }
         return frame;
     }
 
+    std::shared_ptr<Frame> FrameBufferManager::readFrameFile(const std::string &path, std::vector<math::Point> storage)
+    {
+        if (fs::path(path).extension() == FrameBinaryCodec::EXTENSION)
+            return FrameBinaryCodec::readFile(path, std::move(storage));
+
+        // Streams points straight into the cloud instead of building a JSON document first
+        return adapter::FrameJsonStreamParser::readFile(path, adapter::FrameJsonStreamParser::ReadMode::Bulk, std::move(storage));
+    }
+
     void FrameBufferManager::fireCallback()
     {
         if (!onFrameChanged_ && frameObservers_.empty())
             return;
 
-        if (frameWindow_.size() <= static_cast<size_t>(windowSize_))
-            return;
-
-        auto &frame = frameWindow_[windowSize_];
+        const auto &frame = currentFrame_;
         if (!frame)
             return;
 
@@ -256,9 +288,7 @@ namespace simulation
 
     std::shared_ptr<Frame> FrameBufferManager::getCurrentFrame() const
     {
-        if (frameWindow_.size() > static_cast<size_t>(windowSize_))
-            return frameWindow_[windowSize_];
-        return nullptr;
+        return currentFrame_;
     }
 
     void FrameBufferManager::addFrameObserver(const std::shared_ptr<IFrameObserver> &observer)
@@ -266,47 +296,4 @@ namespace simulation
         frameObservers_.push_back(observer);
     }
 
-    void FrameBufferManager::startPreloadingNextFrame()
-    {
-        // Don't start if already preloading
-        if (preloadInProgress_.load())
-            return;
-
-        // Calculate which frame to preload (next one after current window)
-        int nextFrameIndex = currentFrameIndex_ + windowSize_ + 1;
-
-        if (nextFrameIndex >= totalFrameCount_)
-            return; // No more frames to preload
-
-        preloadInProgress_.store(true);
-
-        std::thread([this, nextFrameIndex]()
-                    {
-            try
-            {
-                std::ostringstream filename;
-                filename << "frame_" << std::setw(5) << std::setfill('0') << nextFrameIndex << ".json";
-                std::string path = core::ResourceLocator::getJsonPathForScene(filename.str());
-                
-                // Create a new adapter for thread safety
-                adapter::AdapterManager threadAdapters;
-                auto frame = threadAdapters.fromJson<std::shared_ptr<simulation::Frame>>(path);
-                frame->filePath = path;
-
-                {
-                    std::lock_guard<std::mutex> lock(preloadMutex_);
-                    preloadedFrame_ = frame;
-                    preloadedFrameIndex_ = nextFrameIndex;
-                    hasPreloadedFrame_.store(true);
-                }
-            }
-            catch (const std::exception &e)
-            {
-                LOGGER_WARN("Failed to preload frame: " + std::string(e.what()));
-            }
-
-            preloadInProgress_.store(false); })
-            .detach();
-    }
-
-}
+}
\ No newline at end of file
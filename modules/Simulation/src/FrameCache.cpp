@@ -0,0 +1,95 @@
+#include <simulation/implementations/FrameCache.hpp>
+
+namespace simulation
+{
+    std::shared_ptr<Frame> FrameCache::get(int index)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = lookup_.find(index);
+        if (it == lookup_.end())
+        {
+            stats_.misses++;
+            return nullptr;
+        }
+
+        stats_.hits++;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->frame;
+    }
+
+    bool FrameCache::contains(int index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lookup_.count(index) != 0;
+    }
+
+    void FrameCache::put(int index, std::shared_ptr<Frame> frame)
+    {
+        if (!frame)
+            return;
+
+        const std::size_t bytes = frameBytes(*frame);
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto it = lookup_.find(index);
+        if (it != lookup_.end())
+        {
+            bytes_ -= it->second->bytes;
+            it->second->frame = std::move(frame);
+            it->second->bytes = bytes;
+            entries_.splice(entries_.begin(), entries_, it->second);
+        }
+        else
+        {
+            entries_.push_front(Entry{index, std::move(frame), bytes});
+            lookup_[index] = entries_.begin();
+        }
+        bytes_ += bytes;
+        evictToBudget(1);
+    }
+
+    void FrameCache::setBudget(std::size_t budgetBytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        budgetBytes_ = budgetBytes;
+        evictToBudget(0);
+    }
+
+    void FrameCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        lookup_.clear();
+        bytes_ = 0;
+    }
+
+    FrameCache::Stats FrameCache::getStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.entries = entries_.size();
+        stats.bytes = bytes_;
+        stats.budgetBytes = budgetBytes_;
+        return stats;
+    }
+
+    std::size_t FrameCache::frameBytes(const Frame &frame)
+    {
+        std::size_t bytes = sizeof(Frame) + frame.filePath.capacity();
+        if (frame.cloud)
+            bytes += sizeof(math::PointCloud) + frame.cloud->getPoints().capacity() * sizeof(math::Point);
+        return bytes;
+    }
+
+    void FrameCache::evictToBudget(std::size_t keep)
+    {
+        while (bytes_ > budgetBytes_ && entries_.size() > keep)
+        {
+            const Entry &victim = entries_.back();
+            bytes_ -= victim.bytes;
+            lookup_.erase(victim.index);
+            entries_.pop_back();
+            stats_.evictions++;
+        }
+    }
+}
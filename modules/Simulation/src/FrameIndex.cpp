@@ -0,0 +1,314 @@
+#include <simulation/implementations/FrameIndex.hpp>
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <core/Logger.hpp>
+#include <core/ThreadPool.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <stdexcept>
+
+namespace simulation
+{
+    static_assert(std::endian::native == std::endian::little, "FrameIndex assumes a little-endian host");
+
+    namespace
+    {
+        namespace fs = std::filesystem;
+
+        constexpr std::size_t HEADER_SIZE = 32;
+        constexpr std::size_t DIR_MTIME_OFFSET = 24;
+        constexpr std::size_t ENTRY_FIXED_SIZE = 2 + 8 + 8 + 8 + 8 + 8 + 4; // plus the file name
+
+        std::int64_t mtimeOf(const fs::path &path)
+        {
+            return static_cast<std::int64_t>(fs::last_write_time(path).time_since_epoch().count());
+        }
+
+        // Sorted frame_* files; frame_XXXXX.adsf wins over the frame_XXXXX.json it was converted from
+        std::vector<fs::path> listFrameFiles(const fs::path &frameDir)
+        {
+            std::map<std::string, fs::path> byStem;
+            for (const auto &entry : fs::directory_iterator(frameDir))
+            {
+                const auto &path = entry.path();
+                const auto stem = path.stem().string();
+                const auto extension = path.extension();
+                if (!entry.is_regular_file() || stem.rfind("frame_", 0) != 0 ||
+                    (extension != ".json" && extension != FrameBinaryCodec::EXTENSION))
+                    continue;
+
+                auto [it, inserted] = byStem.emplace(stem, path);
+                if (!inserted && extension == FrameBinaryCodec::EXTENSION)
+                    it->second = path;
+            }
+
+            std::vector<fs::path> files;
+            files.reserve(byStem.size());
+            for (auto &[stem, path] : byStem)
+                files.push_back(std::move(path));
+            return files;
+        }
+
+        template <typename T>
+        void append(std::vector<std::uint8_t> &out, const T &value)
+        {
+            const auto at = out.size();
+            out.resize(at + sizeof(T));
+            std::memcpy(out.data() + at, &value, sizeof(T));
+        }
+
+        // Bounds-checked reader over the sidecar bytes
+        class Reader
+        {
+        public:
+            explicit Reader(const std::vector<std::uint8_t> &bytes) : bytes_(bytes) {}
+
+            template <typename T>
+            T get()
+            {
+                need(sizeof(T));
+                T value;
+                std::memcpy(&value, bytes_.data() + pos_, sizeof(T));
+                pos_ += sizeof(T);
+                return value;
+            }
+
+            std::string getString(std::size_t length)
+            {
+                need(length);
+                std::string value(reinterpret_cast<const char *>(bytes_.data() + pos_), length);
+                pos_ += length;
+                return value;
+            }
+
+            std::size_t remaining() const { return bytes_.size() - pos_; }
+
+        private:
+            void need(std::size_t count) const
+            {
+                if (count > remaining())
+                    throw std::runtime_error("truncated");
+            }
+
+            const std::vector<std::uint8_t> &bytes_;
+            std::size_t pos_ = 0;
+        };
+
+        // Entries of a current sidecar, or nothing if it is missing, damaged or stale
+        std::optional<std::vector<FrameIndex::Entry>> readSidecar(const fs::path &sidecar, const fs::path &frameDir)
+        {
+            std::error_code ec;
+            if (!fs::exists(sidecar, ec))
+                return std::nullopt;
+
+            try
+            {
+                std::ifstream file(sidecar, std::ios::binary);
+                std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                Reader reader(bytes);
+
+                const auto magic = reader.getString(sizeof(FrameIndex::MAGIC));
+                if (std::memcmp(magic.data(), FrameIndex::MAGIC, sizeof(FrameIndex::MAGIC)) != 0 ||
+                    reader.get<std::uint32_t>() != FrameIndex::VERSION)
+                    return std::nullopt;
+                (void)reader.get<std::uint32_t>();
+                const auto count = reader.get<std::uint64_t>();
+                const auto dirMtime = reader.get<std::int64_t>();
+
+                // Adding, removing or renaming a frame file changes the folder's mtime
+                if (dirMtime != mtimeOf(frameDir) || count > reader.remaining() / ENTRY_FIXED_SIZE)
+                    return std::nullopt;
+
+                std::vector<FrameIndex::Entry> entries(static_cast<std::size_t>(count));
+                for (auto &entry : entries)
+                {
+                    const auto nameLength = reader.get<std::uint16_t>();
+                    entry.path = (frameDir / reader.getString(nameLength)).string();
+                    entry.offset = reader.get<std::uint64_t>();
+                    entry.byteSize = reader.get<std::uint64_t>();
+                    entry.mtime = reader.get<std::int64_t>();
+                    entry.pointCount = reader.get<std::uint64_t>();
+                    entry.timestamp = reader.get<double>();
+                    entry.frameId = reader.get<std::int32_t>();
+
+                    // A frame rewritten in place keeps the folder mtime but not its own
+                    if (fs::file_size(entry.path, ec) != entry.byteSize || ec || mtimeOf(entry.path) != entry.mtime)
+                        return std::nullopt;
+                }
+                return entries;
+            }
+            catch (const std::exception &e)
+            {
+                LOGGER_WARN("Ignoring frame index " + sidecar.string() + ": " + e.what());
+                return std::nullopt;
+            }
+        }
+
+        void writeSidecar(const fs::path &sidecar, const fs::path &frameDir, const std::vector<FrameIndex::Entry> &entries)
+        {
+            std::vector<std::uint8_t> bytes(FrameIndex::MAGIC, FrameIndex::MAGIC + sizeof(FrameIndex::MAGIC));
+            append<std::uint32_t>(bytes, FrameIndex::VERSION);
+            append<std::uint32_t>(bytes, 0);
+            append<std::uint64_t>(bytes, entries.size());
+            append<std::int64_t>(bytes, 0); // folder mtime, patched below
+            for (const auto &entry : entries)
+            {
+                const auto name = fs::path(entry.path).filename().string();
+                append<std::uint16_t>(bytes, static_cast<std::uint16_t>(name.size()));
+                bytes.insert(bytes.end(), name.begin(), name.end());
+                append<std::uint64_t>(bytes, entry.offset);
+                append<std::uint64_t>(bytes, entry.byteSize);
+                append<std::int64_t>(bytes, entry.mtime);
+                append<std::uint64_t>(bytes, entry.pointCount);
+                append<double>(bytes, entry.timestamp);
+                append<std::int32_t>(bytes, entry.frameId);
+            }
+
+            std::fstream file(sidecar, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+            file.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+
+            // Creating the sidecar changed the folder mtime; record the value after that. Rewriting
+            // bytes of an existing file does not touch the folder again.
+            const std::int64_t dirMtime = mtimeOf(frameDir);
+            file.seekp(static_cast<std::streamoff>(DIR_MTIME_OFFSET));
+            file.write(reinterpret_cast<const char *>(&dirMtime), sizeof(dirMtime));
+            file.close();
+            if (!file)
+                throw std::runtime_error("cannot write " + sidecar.string());
+        }
+    } // namespace
+
+    FrameIndex FrameIndex::fromPack(const FramePack &pack)
+    {
+        FrameIndex index;
+        index.entries_.resize(pack.frameCount());
+        for (std::size_t i = 0; i < pack.frameCount(); ++i)
+        {
+            const auto view = pack.view(i);
+            auto &entry = index.entries_[i];
+            entry.path = pack.getPath();
+            entry.offset = pack.entry(i).offset;
+            entry.byteSize = pack.entry(i).size;
+            entry.pointCount = view.pointCount;
+            entry.timestamp = pack.timestamp(i);
+            entry.frameId = pack.frameId(i);
+        }
+        index.finalize();
+        return index;
+    }
+
+    FrameIndex FrameIndex::loadOrBuild(const std::string &frameDir, const FileLoader &loader)
+    {
+        static_assert(HEADER_SIZE == sizeof(MAGIC) + 4 + 4 + 8 + 8, "sidecar header layout");
+        const fs::path dir(frameDir);
+        const fs::path sidecar = dir / SIDECAR_FILE_NAME;
+
+        FrameIndex index;
+        if (auto entries = readSidecar(sidecar, dir))
+        {
+            index.entries_ = std::move(*entries);
+            index.fromSidecar_ = true;
+            index.finalize();
+            return index;
+        }
+
+        const auto files = listFrameFiles(dir);
+        index.entries_.resize(files.size());
+        std::vector<std::string> errors(files.size());
+        core::ThreadPool pool;
+        pool.parallelFor(files.size(), [&](std::size_t i)
+                         {
+            // One unreadable frame must not take the whole recording down with it
+            try
+            {
+                auto &entry = index.entries_[i];
+                entry.path = files[i].string();
+                entry.byteSize = fs::file_size(files[i]);
+                entry.mtime = mtimeOf(files[i]);
+
+                const auto frame = loader(entry.path);
+                if (!frame)
+                    throw std::runtime_error("loader returned no frame");
+                entry.pointCount = frame->cloud ? frame->cloud->size() : 0;
+                entry.timestamp = frame->timestamp;
+                entry.frameId = frame->frameId;
+            }
+            catch (const std::exception &e)
+            {
+                errors[i] = e.what()[0] != '\0' ? e.what() : "unknown error";
+            } });
+
+        std::size_t skipped = 0;
+        for (std::size_t i = 0; i < files.size(); ++i)
+        {
+            if (errors[i].empty())
+            {
+                if (skipped > 0)
+                    index.entries_[i - skipped] = std::move(index.entries_[i]);
+                continue;
+            }
+            LOGGER_WARN("Skipping frame " + files[i].string() + ": " + errors[i]);
+            ++skipped;
+        }
+        index.entries_.resize(files.size() - skipped);
+        index.finalize();
+
+        // Without a sidecar the skipped frames are tried again on the next start, e.g. after a fix
+        if (skipped > 0)
+        {
+            LOGGER_WARN("Frame index not saved: " + std::to_string(skipped) + " frame(s) could not be read");
+            return index;
+        }
+
+        try
+        {
+            writeSidecar(sidecar, dir, index.entries_);
+            LOGGER_INFO("FrameIndex", "Indexed " + std::to_string(index.size()) + " frames into " + sidecar.string());
+        }
+        catch (const std::exception &e)
+        {
+            LOGGER_WARN("Frame index not saved: " + std::string(e.what()));
+        }
+        return index;
+    }
+
+    int FrameIndex::findNearest(double timestamp) const
+    {
+        if (entries_.empty())
+            return -1;
+
+        if (!timestampsSorted_)
+        {
+            std::size_t best = 0;
+            for (std::size_t i = 1; i < entries_.size(); ++i)
+            {
+                if (std::abs(entries_[i].timestamp - timestamp) < std::abs(entries_[best].timestamp - timestamp))
+                    best = i;
+            }
+            return static_cast<int>(best);
+        }
+
+        const auto after = std::lower_bound(entries_.begin(), entries_.end(), timestamp,
+                                            [](const Entry &entry, double t)
+                                            { return entry.timestamp < t; });
+        if (after == entries_.begin())
+            return 0;
+        if (after == entries_.end())
+            return static_cast<int>(entries_.size() - 1);
+
+        const auto before = after - 1;
+        const auto nearest = (timestamp - before->timestamp) <= (after->timestamp - timestamp) ? before : after;
+        return static_cast<int>(nearest - entries_.begin());
+    }
+
+    void FrameIndex::finalize()
+    {
+        timestampsSorted_ = std::is_sorted(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b)
+                                           { return a.timestamp < b.timestamp; });
+    }
+}
@@ -0,0 +1,189 @@
+#include <simulation/implementations/FramePack.hpp>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace simulation
+{
+    static_assert(std::endian::native == std::endian::little, "FramePack assumes a little-endian host");
+
+    namespace
+    {
+        template <typename T>
+        T get(const std::uint8_t *in, std::size_t offset)
+        {
+            T value;
+            std::memcpy(&value, in + offset, sizeof(T));
+            return value;
+        }
+
+        template <typename T>
+        void put(std::uint8_t *out, std::size_t offset, const T &value)
+        {
+            std::memcpy(out + offset, &value, sizeof(T));
+        }
+    } // namespace
+
+    std::unique_ptr<FramePack> FramePack::open(const std::string &path)
+    {
+        std::unique_ptr<FramePack> pack(new FramePack(utils::MappedFile(path)));
+        const std::uint8_t *data = pack->file_.data();
+        const std::size_t size = pack->file_.size();
+
+        if (size < HEADER_SIZE + TRAILER_SIZE || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            throw std::runtime_error("FramePack: " + path + " is not an ADSPACK file");
+        }
+        if (get<std::uint32_t>(data, 8) != VERSION)
+        {
+            throw std::runtime_error("FramePack: unsupported format version " + std::to_string(get<std::uint32_t>(data, 8)));
+        }
+
+        const std::uint8_t *trailer = data + size - TRAILER_SIZE;
+        if (std::memcmp(trailer + 16, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0)
+        {
+            throw std::runtime_error("FramePack: " + path + " has no index (truncated or unfinished)");
+        }
+
+        const std::uint64_t indexOffset = get<std::uint64_t>(trailer, 0);
+        const std::uint64_t count = get<std::uint64_t>(trailer, 8);
+        const std::uint64_t indexEnd = size - TRAILER_SIZE;
+        if (indexOffset < HEADER_SIZE || indexOffset > indexEnd || (indexEnd - indexOffset) / INDEX_ENTRY_SIZE != count ||
+            (indexEnd - indexOffset) % INDEX_ENTRY_SIZE != 0)
+        {
+            throw std::runtime_error("FramePack: index of " + path + " does not match the file size");
+        }
+
+        pack->index_.resize(static_cast<std::size_t>(count));
+        for (std::size_t i = 0; i < pack->index_.size(); ++i)
+        {
+            const std::uint8_t *raw = data + indexOffset + i * INDEX_ENTRY_SIZE;
+            IndexEntry &e = pack->index_[i];
+            e.offset = get<std::uint64_t>(raw, 0);
+            e.size = get<std::uint64_t>(raw, 8);
+            e.timestamp = get<double>(raw, 16);
+            e.frameId = get<std::int32_t>(raw, 24);
+
+            // Frames must sit between the header and the index, aligned for in-place float access
+            if (e.offset < HEADER_SIZE || e.offset % ALIGNMENT != 0 || e.size > indexOffset || e.offset > indexOffset - e.size)
+            {
+                throw std::runtime_error("FramePack: frame " + std::to_string(i) + " of " + path + " is out of range");
+            }
+        }
+        return pack;
+    }
+
+    const FramePack::IndexEntry &FramePack::entry(std::size_t index) const
+    {
+        if (index >= index_.size())
+        {
+            throw std::out_of_range("FramePack: frame " + std::to_string(index) + " out of range (" +
+                                    std::to_string(index_.size()) + " frames)");
+        }
+        return index_[index];
+    }
+
+    FrameBinaryCodec::View FramePack::view(std::size_t index) const
+    {
+        const IndexEntry &e = entry(index);
+        return FrameBinaryCodec::view(file_.data() + e.offset, static_cast<std::size_t>(e.size));
+    }
+
+    std::shared_ptr<Frame> FramePack::loadFrame(std::size_t index, std::vector<math::Point> storage) const
+    {
+        const FrameBinaryCodec::View encoded = view(index);
+
+        auto frame = std::make_shared<Frame>();
+        frame->frameId = encoded.frameId;
+        frame->timestamp = encoded.timestamp;
+        frame->linearAcceleration = encoded.linearAcceleration;
+        frame->angularVelocity = encoded.angularVelocity;
+        frame->filePath = file_.getPath() + "#" + std::to_string(index);
+
+        std::vector<math::Point> points = std::move(storage);
+        points.clear();
+        points.reserve(static_cast<std::size_t>(encoded.pointCount));
+        for (std::size_t i = 0; i < encoded.xyz.size(); i += 3)
+        {
+            points.emplace_back(encoded.xyz[i], encoded.xyz[i + 1], encoded.xyz[i + 2]);
+        }
+        frame->cloud = std::make_shared<math::PointCloud>(std::move(points));
+        return frame;
+    }
+
+    FramePackWriter::FramePackWriter(const std::string &path)
+        : path_(path), file_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!file_)
+        {
+            throw std::runtime_error("FramePackWriter: cannot open " + path + " for writing");
+        }
+
+        std::uint8_t header[FramePack::HEADER_SIZE] = {};
+        std::memcpy(header, FramePack::MAGIC, sizeof(FramePack::MAGIC));
+        put<std::uint32_t>(header, 8, FramePack::VERSION);
+        write(header, sizeof(header));
+    }
+
+    void FramePackWriter::append(const Frame &frame)
+    {
+        if (finished_)
+        {
+            throw std::runtime_error("FramePackWriter: append after finish on " + path_);
+        }
+
+        const auto bytes = FrameBinaryCodec::encode(frame);
+        FramePack::IndexEntry e;
+        e.offset = offset_;
+        e.size = bytes.size();
+        e.timestamp = frame.timestamp;
+        e.frameId = frame.frameId;
+        write(bytes.data(), bytes.size());
+
+        static constexpr std::uint8_t padding[FramePack::ALIGNMENT] = {};
+        write(padding, static_cast<std::size_t>((FramePack::ALIGNMENT - offset_ % FramePack::ALIGNMENT) % FramePack::ALIGNMENT));
+        index_.push_back(e);
+    }
+
+    void FramePackWriter::finish()
+    {
+        if (finished_)
+        {
+            return;
+        }
+
+        const std::uint64_t indexOffset = offset_;
+        std::vector<std::uint8_t> tail(index_.size() * FramePack::INDEX_ENTRY_SIZE + FramePack::TRAILER_SIZE, 0);
+        for (std::size_t i = 0; i < index_.size(); ++i)
+        {
+            std::uint8_t *raw = tail.data() + i * FramePack::INDEX_ENTRY_SIZE;
+            put<std::uint64_t>(raw, 0, index_[i].offset);
+            put<std::uint64_t>(raw, 8, index_[i].size);
+            put<double>(raw, 16, index_[i].timestamp);
+            put<std::int32_t>(raw, 24, index_[i].frameId);
+        }
+
+        std::uint8_t *trailer = tail.data() + index_.size() * FramePack::INDEX_ENTRY_SIZE;
+        put<std::uint64_t>(trailer, 0, indexOffset);
+        put<std::uint64_t>(trailer, 8, static_cast<std::uint64_t>(index_.size()));
+        std::memcpy(trailer + 16, FramePack::INDEX_MAGIC, sizeof(FramePack::INDEX_MAGIC));
+        write(tail.data(), tail.size());
+
+        file_.close();
+        if (!file_)
+        {
+            throw std::runtime_error("FramePackWriter: failed to close " + path_);
+        }
+        finished_ = true;
+    }
+
+    void FramePackWriter::write(const void *data, std::size_t size)
+    {
+        file_.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        if (!file_)
+        {
+            throw std::runtime_error("FramePackWriter: failed to write " + path_);
+        }
+        offset_ += size;
+    }
+}
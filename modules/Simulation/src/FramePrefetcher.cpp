@@ -0,0 +1,165 @@
+#include <simulation/implementations/FramePrefetcher.hpp>
+#include <core/Logger.hpp>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace simulation
+{
+    FramePrefetcher::FramePrefetcher(FrameCache &cache, Loader loader, int frameCount, int lookAhead, int lookBehind,
+                                     std::size_t ioThreads)
+        : cache_(cache),
+          loader_(std::move(loader)),
+          frameCount_(frameCount),
+          lookAhead_(std::max(0, lookAhead)),
+          lookBehind_(std::max(0, lookBehind)),
+          pool_(resolveIoThreads(ioThreads, lookAhead, lookBehind))
+    {
+    }
+
+    std::size_t FramePrefetcher::resolveIoThreads(std::size_t requested, int lookAhead, int lookBehind)
+    {
+        if (requested != AUTO_IO_THREADS)
+            return requested;
+
+        const unsigned int cores = std::thread::hardware_concurrency();
+        const auto windowFrames = static_cast<std::size_t>(std::max(0, lookAhead) + std::max(0, lookBehind) + 1);
+        const std::size_t threads = std::clamp<std::size_t>(cores, 2, MAX_AUTO_IO_THREADS);
+        return std::max<std::size_t>(1, std::min(threads, windowFrames));
+    }
+
+    FramePrefetcher::~FramePrefetcher()
+    {
+        // Queued tasks still run when the pool shuts down; with nothing wanted they return at once
+        std::lock_guard<std::mutex> lock(mutex_);
+        wanted_.clear();
+    }
+
+    void FramePrefetcher::request(int center, int direction, bool includeCenter)
+    {
+        const int step = direction < 0 ? -1 : 1;
+        std::vector<int> order;
+        order.reserve(static_cast<std::size_t>(lookAhead_ + lookBehind_ + 1));
+        if (includeCenter)
+            order.push_back(center);
+        for (int k = 1; k <= lookAhead_; ++k)
+            order.push_back(center + step * k);
+        for (int k = 1; k <= lookBehind_; ++k)
+            order.push_back(center - step * k);
+
+        std::vector<int> submit;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wanted_.clear();
+            for (int index : order)
+            {
+                if (index < 0 || index >= frameCount_)
+                    continue;
+                wanted_.insert(index);
+                if (!queued_.count(index) && !inFlight_.count(index) && !cache_.contains(index))
+                {
+                    queued_.insert(index);
+                    failed_.erase(index);
+                    submit.push_back(index);
+                }
+            }
+            stats_.requested += submit.size();
+        }
+
+        for (int index : submit)
+        {
+            pool_.submit([this, index]
+                         { loadTask(index); });
+        }
+    }
+
+    std::shared_ptr<Frame> FramePrefetcher::acquire(int index)
+    {
+        bool stalled = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (inFlight_.count(index))
+            {
+                stalled = true;
+                stats_.stalls++;
+                loaded_.wait(lock, [this, index]
+                             { return inFlight_.count(index) == 0; });
+            }
+        }
+
+        if (auto frame = cache_.get(index))
+            return frame;
+
+        if (!stalled)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stats_.stalls++;
+        }
+        auto frame = loader_(index);
+        cache_.put(index, frame);
+        return frame;
+    }
+
+    bool FramePrefetcher::isPending(int index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queued_.count(index) != 0 || inFlight_.count(index) != 0;
+    }
+
+    bool FramePrefetcher::hasFailed(int index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return failed_.count(index) != 0;
+    }
+
+    FramePrefetcher::Stats FramePrefetcher::getStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.queueDepth = queued_.size();
+        stats.inFlight = inFlight_.size();
+        return stats;
+    }
+
+    void FramePrefetcher::loadTask(int index)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queued_.erase(index);
+            if (!wanted_.count(index) || cache_.contains(index))
+            {
+                stats_.cancelled++;
+                return;
+            }
+            inFlight_.insert(index);
+        }
+
+        bool failed = false;
+        try
+        {
+            cache_.put(index, loader_(index));
+        }
+        catch (const std::exception &e)
+        {
+            failed = true;
+            // A missing file fails again on every window move; failures are counted in the stats
+            LOGGER_WARN_EVERY_MS(1000, "Failed to prefetch frame " + std::to_string(index) + ": " + e.what());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            inFlight_.erase(index);
+            if (failed)
+            {
+                failed_.insert(index);
+                stats_.failures++;
+            }
+            else
+            {
+                failed_.erase(index);
+                stats_.completed++;
+            }
+        }
+        loaded_.notify_all();
+    }
+}
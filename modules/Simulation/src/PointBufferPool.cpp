@@ -0,0 +1,90 @@
+#include <simulation/implementations/PointBufferPool.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace simulation
+{
+    std::vector<math::Point> PointBufferPool::acquire(std::size_t pointCount)
+    {
+        std::vector<math::Point> points;
+        std::size_t capacity = pointCount;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // New and grown buffers get the largest size seen so far, so a recording whose frame
+            // sizes vary a little stops growing buffers once every size has come by once
+            largestRequest_ = std::max(largestRequest_, pointCount);
+            capacity = largestRequest_;
+
+            if (!buffers_.empty())
+            {
+                // Smallest buffer that fits; if none does, grow the largest one
+                auto best = buffers_.end();
+                auto largest = buffers_.begin();
+                for (auto it = buffers_.begin(); it != buffers_.end(); ++it)
+                {
+                    if (it->capacity() >= pointCount && (best == buffers_.end() || it->capacity() < best->capacity()))
+                        best = it;
+                    if (it->capacity() > largest->capacity())
+                        largest = it;
+                }
+                auto taken = best != buffers_.end() ? best : largest;
+                (best != buffers_.end() ? stats_.reused : stats_.grown)++;
+
+                std::swap(*taken, buffers_.back());
+                points = std::move(buffers_.back());
+                buffers_.pop_back();
+            }
+            else
+            {
+                stats_.allocated++;
+            }
+        }
+
+        // Outside the lock: growing a buffer is the expensive part
+        points.clear();
+        if (points.capacity() < pointCount)
+            points.reserve(capacity);
+        return points;
+    }
+
+    std::shared_ptr<const math::PointCloud> PointBufferPool::share(math::PointCloud &&cloud)
+    {
+        std::weak_ptr<PointBufferPool> pool = weak_from_this();
+        return std::shared_ptr<const math::PointCloud>(new math::PointCloud(std::move(cloud)), [pool](math::PointCloud *shared)
+                                                 {
+            if (auto owner = pool.lock())
+                owner->recycle(shared->takePoints());
+            delete shared; });
+    }
+
+    void PointBufferPool::recycle(std::vector<math::Point> &&points)
+    {
+        if (points.capacity() == 0)
+            return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (buffers_.size() >= maxBuffers_)
+        {
+            stats_.dropped++;
+            return; // freed by the caller's vector going out of scope
+        }
+        stats_.recycled++;
+        buffers_.push_back(std::move(points));
+    }
+
+    void PointBufferPool::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_.clear();
+    }
+
+    PointBufferPool::Stats PointBufferPool::getStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Stats stats = stats_;
+        stats.pooledBuffers = buffers_.size();
+        for (const auto &buffer : buffers_)
+            stats.pooledBytes += buffer.capacity() * sizeof(math::Point);
+        return stats;
+    }
+}
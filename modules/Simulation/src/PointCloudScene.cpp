@@ -38,7 +38,7 @@ PointCloudScene::PointCloudScene(const std::string &jsonPath)
     }
 }
 
-std::shared_ptr<math::PointCloud> PointCloudScene::getMergedPointCloud(int) const
+std::shared_ptr<const math::PointCloud> PointCloudScene::getMergedPointCloud(int) const
 {
     return cloud_;
 }
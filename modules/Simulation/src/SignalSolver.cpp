@@ -3,121 +3,336 @@
 #include <utils/DataExporter.hpp>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 #include <limits>
+#include <bit>
 #include <cmath>
 
 using namespace math;
 
 namespace simulation
 {
-    SignalSolver::SignalSolver(std::shared_ptr<SimulationScene> scene)
+    SignalSolver::SignalSolver(std::shared_ptr<SimulationScene> scene, std::size_t workerThreads)
         : scene_(std::move(scene))
     {
+        if (workerThreads != 1)
+        {
+            // The calling thread takes part in every parallel section, so it needs one worker fewer
+            pool_ = std::make_unique<core::ThreadPool>(workerThreads == 0 ? 0 : workerThreads - 1);
+        }
+    }
+
+    void SignalSolver::setEchoCount(size_t echoes)
+    {
+        if (echoes == 0 || echoes > MAX_ECHOES)
+        {
+            throw std::invalid_argument("SignalSolver: echo count must be between 1 and " + std::to_string(MAX_ECHOES));
+        }
+        if (echoes != echoCount_)
+        {
+            echoCount_ = echoes;
+            pairResults_.clear(); // cached pairs hold the old number of echoes
+        }
+    }
+
+    void SignalSolver::runParallel(size_t count, const std::function<void(size_t)> &body)
+    {
+        if (pool_)
+        {
+            pool_->parallelFor(count, body);
+            return;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+    }
+
+    core::FrameArena::Stats SignalSolver::getLastArenaStats() const
+    {
+        std::lock_guard<std::mutex> lock(arenaStatsMutex_);
+        return lastArenaStats_;
+    }
+
+    SignalSolver::SceneSnapshot SignalSolver::captureScene() const
+    {
+        SceneSnapshot scene;
+        scene.cloud = scene_->getMergedPointCloud();
+        scene.transmitters = scene_->getTransmitters();
+        scene.receivers = scene_->getReceivers();
+        scene.txFrusta.reserve(scene.transmitters.size());
+        for (const auto &transmitter : scene.transmitters)
+        {
+            scene.txFrusta.push_back(transmitter->getFrustum());
+        }
+        scene.rxFrusta.reserve(scene.receivers.size());
+        for (const auto &receiver : scene.receivers)
+        {
+            scene.rxFrusta.push_back(receiver->getFrustum());
+        }
+        return scene;
+    }
+
+    void SignalSolver::prepare()
+    {
+        auto scene = captureScene();
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        pending_ = std::move(scene);
     }
 
     std::shared_ptr<math::PointCloud> SignalSolver::solve()
+    {
+        std::optional<SceneSnapshot> scene;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            scene.swap(pending_);
+        }
+        if (!scene)
+        {
+            scene = captureScene(); // not prepared: the caller owns the scene graph
+        }
+
+        // Scratch of the previous solve is dead by now; the returned cloud is heap-owned
+        arena_.reset();
+        auto result = solveFrame(*scene);
+
+        std::lock_guard<std::mutex> lock(arenaStatsMutex_);
+        lastArenaStats_ = arena_.getStats();
+        return result;
+    }
+
+    std::shared_ptr<math::PointCloud> SignalSolver::solveFrame(const SceneSnapshot &scene)
     {
         // First, calculate ToF points and build the matrix
         auto result = std::make_shared<PointCloud>();
-        auto allPoints = scene_->getMergedPointCloud();
+        const auto &allPoints = scene.cloud;
 
         if (!allPoints || allPoints->empty())
         {
             return result;
         }
 
-        const auto &transmitters = scene_->getTransmitters();
-        const auto &receivers = scene_->getReceivers();
+        const auto &transmitters = scene.transmitters;
+        const auto &receivers = scene.receivers;
 
         if (transmitters.empty() || receivers.empty())
         {
             return result;
         }
 
-        TofMatrix tofMatrix(transmitters.size(), receivers.size());
+        // Spatial index over the same cloud snapshot; built once per cloud change by the scene
+        auto index = scene_->getPointIndex(allPoints, pool_.get());
+
+        TofMatrix tofMatrix(transmitters.size(), receivers.size(), echoCount_, arena_.resource());
 
-        // Calculate ToF values and collect points
-        for (size_t txIndex = 0; txIndex < transmitters.size(); ++txIndex)
+        // Calculate ToF values for every pair in one pass over the cloud
+        if (findClosestPointsPerPair(scene, index, tofMatrix) == 0)
         {
-            const auto &transmitter = transmitters[txIndex];
+            return result;
+        }
 
-            for (size_t rxIndex = 0; rxIndex < receivers.size(); ++rxIndex)
-            {
-                const auto &receiver = receivers[rxIndex];
+        // Now solve ADSIL trilateration
+        return solveAdsilTrilateration(scene, tofMatrix);
+    }
 
-                auto filteredPoints = filterPointsByFov(allPoints, transmitter, receiver);
-                if (!filteredPoints || filteredPoints->empty())
-                {
-                    continue;
-                }
+    namespace
+    {
+        // Region seen by both devices of a pair, as a PointKdTree query volume
+        struct PairVolume
+        {
+            const DeviceFrustum &tx;
+            const DeviceFrustum &rx;
 
-                auto closestPoint = findClosestPointInFov(filteredPoints, transmitter, receiver);
-                float totalDistance =
-                    closestPoint.distanceTo(transmitter->getTransformNode()->getGlobalTransform().getPosition()) +
-                    closestPoint.distanceTo(receiver->getTransformNode()->getGlobalTransform().getPosition());
+            bool intersects(const Aabb &box) const { return tx.intersects(box) && rx.intersects(box); }
+            bool contains(const Point &p) const { return tx.contains(p) && rx.contains(p); }
+        };
 
-                tofMatrix(txIndex, rxIndex) = totalDistance;
-                solveCount_++;
-                result->addPoint(closestPoint);
-            }
+        // splitmix64 finalizer
+        std::uint64_t mix(std::uint64_t value)
+        {
+            value += 0x9e3779b97f4a7c15ULL;
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+            return value ^ (value >> 31);
         }
 
-        if (result->empty())
+        // Hashes the exact coordinates, so any moved, added or removed point changes the result
+        std::uint64_t hashPoint(const Point &p)
         {
-            return result;
+            const auto x = std::bit_cast<std::uint32_t>(p.x());
+            const auto y = std::bit_cast<std::uint32_t>(p.y());
+            const auto z = std::bit_cast<std::uint32_t>(p.z());
+            return mix(mix((static_cast<std::uint64_t>(x) << 32) | y) ^ z);
         }
 
-        // Now solve ADSIL trilateration
-        return solveAdsilTrilateration(tofMatrix);
-    }
+        struct SubsetHash
+        {
+            std::uint64_t hash = 0;
+            size_t count = 0;
+        };
+
+        // Summing per-point hashes makes the result independent of the tree order
+        SubsetHash hashSubset(const DeviceFrustum &frustum, const PointCloud &points, const PointKdTree &index)
+        {
+            const auto &cloudPoints = points.getPoints();
+            SubsetHash subset;
+            index.query(frustum, [&](std::uint32_t i)
+                        {
+                subset.hash += hashPoint(cloudPoints[i]);
+                ++subset.count; });
+            return subset;
+        }
+    } // namespace
 
-    std::shared_ptr<math::PointCloud> SignalSolver::filterPointsByFov(
-        const std::shared_ptr<math::PointCloud> &allPoints,
-        const std::shared_ptr<Device> &transmitter,
-        const std::shared_ptr<Device> &receiver) const
+    void SignalSolver::refreshDeviceInputs(const FrustumList &frusta,
+                                           const math::PointCloud &points,
+                                           const math::PointKdTree &index,
+                                           std::vector<DeviceInputs> &inputs,
+                                           FlagList &changed)
     {
-        // Filter points inside transmitter FOV first
-        auto inTxFov = transmitter->pointsInFov(*allPoints);
-        if (!inTxFov || inTxFov->empty())
+        if (inputs.size() != frusta.size())
         {
-            return std::make_shared<PointCloud>();
+            inputs.assign(frusta.size(), DeviceInputs{});
         }
+        changed.assign(frusta.size(), 1);
+
+        // The scene hands out the same index until the frame cloud changes
+        const bool cloudChanged = &index != lastIndex_.get();
+
+        runParallel(frusta.size(), [&](size_t d)
+                    {
+            DeviceInputs &cached = inputs[d];
+            if (cached.frustum != frusta[d])
+            {
+                // Moved or reconfigured: searched again regardless of the points
+                cached.frustum = frusta[d];
+                cached.subsetKnown = false;
+                return;
+            }
+            if (!cloudChanged)
+            {
+                changed[d] = 0;
+                return;
+            }
 
-        // Then filter by receiver FOV
-        auto inRxFov = receiver->pointsInFov(*inTxFov);
-        return inRxFov ? inRxFov : std::make_shared<PointCloud>();
+            // Same frustum over a new cloud: unchanged only if it still sees the same points
+            if (!cached.subsetKnown && lastIndex_ && lastCloud_)
+            {
+                const SubsetHash previous = hashSubset(*frusta[d], *lastCloud_, *lastIndex_);
+                cached.subsetKnown = true;
+                cached.subsetHash = previous.hash;
+                cached.subsetCount = previous.count;
+            }
+
+            const SubsetHash current = hashSubset(*frusta[d], points, index);
+            changed[d] = !(cached.subsetKnown && cached.subsetHash == current.hash && cached.subsetCount == current.count);
+            cached.subsetKnown = true;
+            cached.subsetHash = current.hash;
+            cached.subsetCount = current.count; });
     }
 
-    math::Point SignalSolver::findClosestPointInFov(
-        const std::shared_ptr<math::PointCloud> &points,
-        const std::shared_ptr<Device> &transmitter,
-        const std::shared_ptr<Device> &receiver) const
+    size_t SignalSolver::findClosestPointsPerPair(const SceneSnapshot &scene,
+                                                  const std::shared_ptr<const math::PointKdTree> &index,
+                                                  TofMatrix &tofMatrix)
     {
-        if (!points || points->empty())
+        const PointCloud &points = *scene.cloud;
+        const FrustumList &txFrusta = scene.txFrusta;
+        const FrustumList &rxFrusta = scene.rxFrusta;
+        const size_t txCount = txFrusta.size();
+        const size_t rxCount = rxFrusta.size();
+
+        if (pairResults_.size() != txCount * rxCount)
         {
-            throw std::runtime_error("No points provided to find closest point");
+            pairResults_.assign(txCount * rxCount, PairResult{});
         }
 
-        float minDistance = std::numeric_limits<float>::max();
-        Point closestPoint;
+        FlagList txChanged(arena_.resource());
+        FlagList rxChanged(arena_.resource());
+        refreshDeviceInputs(txFrusta, points, *index, txInputs_, txChanged);
+        refreshDeviceInputs(rxFrusta, points, *index, rxInputs_, rxChanged);
+
+        // Every pair writes only its own result slot
+        const auto &cloudPoints = points.getPoints();
+        FlagList searched(txCount * rxCount, 0, arena_.resource());
+        runParallel(txCount * rxCount, [&](size_t pair)
+                    {
+            const size_t txIndex = pair / rxCount;
+            const size_t rxIndex = pair % rxCount;
+            PairResult &cached = pairResults_[pair];
+            if (cached.valid && !txChanged[txIndex] && !rxChanged[rxIndex])
+            {
+                return; // Same devices over the same points: the previous answer still holds
+            }
+
+            const Point &txPosition = txFrusta[txIndex]->getOrigin();
+            const Point &rxPosition = rxFrusta[rxIndex]->getOrigin();
+            const PairVolume volume{*txFrusta[txIndex], *rxFrusta[rxIndex]};
+
+            // Warm start from last solve's winner if that index still lies in both FOVs
+            PointKdTree::Nearest seed;
+            const std::uint32_t hint = cached.winner;
+            if (hint < cloudPoints.size() && volume.contains(cloudPoints[hint]))
+            {
+                const Point &p = cloudPoints[hint];
+                seed = {hint, p.distanceTo(txPosition) + p.distanceTo(rxPosition)};
+            }
+
+            // The arena is not thread-safe; searches reuse per-thread storage instead
+            thread_local PointKdTree::SearchScratch scratch;
+            thread_local std::vector<PointKdTree::Nearest> echoes;
+
+            cached.valid = true;
+            cached.echoes = 0;
+            if (echoCount_ == 1)
+            {
+                const auto hit = index->nearestBistatic(txPosition, rxPosition, volume, seed, &scratch);
+                cached.winner = hit.index;
+                if (hit.found())
+                {
+                    cached.tofs[cached.echoes++] = hit.distance;
+                }
+            }
+            else
+            {
+                index->kNearestBistatic(txPosition, rxPosition, volume, echoCount_, echoes, &scratch);
+                cached.winner = echoes.empty() ? PointKdTree::NO_INDEX : echoes.front().index;
+                for (const auto &echo : echoes)
+                {
+                    cached.tofs[cached.echoes++] = echo.distance;
+                }
+            }
+            searched[pair] = 1; });
 
-        const auto &txPosition = transmitter->getTransformNode()->getGlobalTransform().getPosition();
-        const auto &rxPosition = receiver->getTransformNode()->getGlobalTransform().getPosition();
+        // Kept alive so the next solve can hash what a device saw in this frame
+        lastCloud_ = scene.cloud;
+        lastIndex_ = index;
 
-        for (const auto &point : points->getPoints())
+        lastPairStats_ = PairStats{};
+        size_t solvedPairs = 0;
+        for (size_t pair = 0; pair < pairResults_.size(); ++pair)
         {
-            float txDistance = point.distanceTo(txPosition);
-            float rxDistance = point.distanceTo(rxPosition);
-            float totalDistance = txDistance + rxDistance;
+            if (searched[pair])
+            {
+                lastPairStats_.searchedPairs++;
+            }
+            else
+            {
+                lastPairStats_.reusedPairs++;
+            }
 
-            if (totalDistance < minDistance)
+            const PairResult &cached = pairResults_[pair];
+            for (size_t echo = 0; echo < cached.echoes; ++echo)
             {
-                minDistance = totalDistance;
-                closestPoint = point;
+                tofMatrix(pair / rxCount, pair % rxCount, echo) = cached.tofs[echo];
+            }
+            if (cached.echoes > 0)
+            {
+                solveCount_++;
+                solvedPairs++;
             }
         }
 
-        return closestPoint;
+        return solvedPairs;
     }
 
     bool SignalSolver::isValidTofRow(const TofMatrix &tofMatrix, size_t txIndex) const
@@ -138,73 +353,197 @@ namespace simulation
         return true;
     }
 
-    std::pair<math::Point, math::Point> SignalSolver::calculateAdsilPositions(
-        const TofMatrix &tofMatrix,
-        size_t txIndex,
-        const SharedVec<Device> &receivers) const
+    const char *SignalSolver::toString(TrilaterationStatus status)
     {
-        // Calculate relative distances
-        float R0 = tofMatrix(txIndex, 0) / 2.0f;
-        float R1 = tofMatrix(txIndex, 1) - R0;
-        float R2 = tofMatrix(txIndex, 2) - R0;
-        float R3 = tofMatrix(txIndex, 3) - R0;
-
-        // Get receiver positions (using receivers 1, 2, 3 for the calculation)
-        auto c1 = receivers[1]->getGlobalTransform().getPosition();
-        auto c2 = receivers[2]->getGlobalTransform().getPosition();
-        auto c3 = receivers[3]->getGlobalTransform().getPosition();
-
-        // Create coordinate system
-        Vector P1P2 = c2.toVectorFrom(c1);
-        float d = std::sqrt(P1P2.dot(P1P2));
-
-        if (d < EPSILON)
+        switch (status)
         {
-            throw std::runtime_error("Receivers P1 and P2 are too close together");
+        case TrilaterationStatus::Ok:
+            return "Ok";
+        case TrilaterationStatus::InvalidTof:
+            return "Invalid ToF measurements";
+        case TrilaterationStatus::ReceiversTooClose:
+            return "Receivers P1 and P2 are too close together";
+        case TrilaterationStatus::ReceiversCollinear:
+            return "Receivers are collinear";
+        case TrilaterationStatus::NoRealSolution:
+            return "Invalid trilateration solution";
         }
+        return "Unknown";
+    }
 
-        Vector ex = P1P2 * (1.0f / d); // normalize
-
-        Vector c1c3 = c3.toVectorFrom(c1);
-        float i = ex.dot(c1c3);
+    const SignalSolver::ReceiverBasis &SignalSolver::receiverBasis(const FrustumList &rxFrusta)
+    {
+        // Devices hand out a new frustum after every pose change, so the same frusta mean the
+        // receivers have not moved
+        if (basisFrusta_ == rxFrusta)
+        {
+            return basis_;
+        }
+        basisFrusta_ = rxFrusta;
 
-        Vector temp = c1c3 - (ex * i);
-        float tempLengthSquared = temp.dot(temp);
+        // Receivers 1, 2, 3 span the frame; receiver 0 only contributes through R0.
+        // A frustum's origin is its device's global position.
+        const Point c1 = rxFrusta[1]->getOrigin();
+        const Point c2 = rxFrusta[2]->getOrigin();
+        const Point c3 = rxFrusta[3]->getOrigin();
 
-        if (tempLengthSquared < EPSILON)
+        basis_ = ReceiverBasis{};
+        basis_.origin = c1;
+        for (size_t a = 0; a < REQUIRED_RECEIVER_COUNT; ++a)
         {
-            throw std::runtime_error("Receivers are collinear");
+            for (size_t b = 0; b < REQUIRED_RECEIVER_COUNT; ++b)
+            {
+                basis_.baselines[a][b] = rxFrusta[a]->getOrigin().distanceTo(rxFrusta[b]->getOrigin());
+            }
         }
 
-        Vector ey = temp.normalized();
-        Vector ez = ex.cross(ey);
-        float j = ey.dot(c1c3);
+        Vector P1P2 = c2.toVectorFrom(c1);
+        basis_.d = std::sqrt(P1P2.dot(P1P2));
+        if (basis_.d < EPSILON)
+        {
+            basis_.status = TrilaterationStatus::ReceiversTooClose;
+            return basis_;
+        }
 
-        // Trilateration calculations
-        float x = (R1 * R1 - R2 * R2 + d * d) / (2.0f * d);
-        float y_numerator = R1 * R1 - R3 * R3 + i * i + j * j - 2.0f * i * x;
-        float y = y_numerator / (2.0f * j);
+        basis_.ex = P1P2 * (1.0f / basis_.d); // normalize
 
-        float zSquared = R1 * R1 - x * x - y * y;
+        Vector c1c3 = c3.toVectorFrom(c1);
+        basis_.i = basis_.ex.dot(c1c3);
 
-        if (zSquared < 0.0f)
+        Vector temp = c1c3 - (basis_.ex * basis_.i);
+        if (temp.dot(temp) < EPSILON)
         {
-            throw std::runtime_error("Invalid trilateration solution");
+            basis_.status = TrilaterationStatus::ReceiversCollinear;
+            return basis_;
         }
 
-        float z = std::sqrt(zSquared);
+        basis_.ey = temp.normalized();
+        basis_.ez = basis_.ex.cross(basis_.ey);
+        basis_.j = basis_.ey.dot(c1c3);
+        return basis_;
+    }
+
+    void SignalSolver::trilaterateRows(const TofMatrix &tofMatrix, const ReceiverBasis &basis, TrilaterationBatch &batch) const
+    {
+        const size_t rows = tofMatrix.txCount;
+        batch.status.assign(rows, TrilaterationStatus::Ok);
+        batch.begin.assign(rows + 1, 0);
+        batch.x.clear();
+        batch.y.clear();
+        batch.z.clear();
+
+        const float d = basis.d;
+        const float i = basis.i;
+        const float j = basis.j;
+        const float ox = basis.origin.x(), oy = basis.origin.y(), oz = basis.origin.z();
+        const float exx = basis.ex.x(), exy = basis.ex.y(), exz = basis.ex.z();
+        const float eyx = basis.ey.x(), eyy = basis.ey.y(), eyz = basis.ey.z();
+        const float ezx = basis.ez.x(), ezy = basis.ez.y(), ezz = basis.ez.z();
+
+        // Solves one choice of ToF per receiver and appends both solutions; false when z^2 < 0
+        auto solveHypothesis = [&](float tof0, float tof1, float tof2, float tof3)
+        {
+            // Calculate relative distances
+            const float R0 = tof0 / 2.0f;
+            const float R1 = tof1 - R0;
+            const float R2 = tof2 - R0;
+            const float R3 = tof3 - R0;
+
+            // Trilateration calculations
+            const float x = (R1 * R1 - R2 * R2 + d * d) / (2.0f * d);
+            const float y = (R1 * R1 - R3 * R3 + i * i + j * j - 2.0f * i * x) / (2.0f * j);
+            const float zSquared = R1 * R1 - x * x - y * y;
+            if (zSquared < 0.0f)
+            {
+                return false;
+            }
+            const float z = std::sqrt(zSquared);
+
+            // Both solutions: origin + ex*x + ey*y +/- ez*z
+            for (const float zs : {z, -z})
+            {
+                batch.x.push_back(ox + (exx * x + eyx * y + ezx * zs));
+                batch.y.push_back(oy + (exy * x + eyy * y + ezy * zs));
+                batch.z.push_back(oz + (exz * x + eyz * y + ezz * zs));
+            }
+            return true;
+        };
+
+        const size_t echoes = tofMatrix.echoCount;
+        for (size_t row = 0; row < rows; ++row)
+        {
+            batch.begin[row] = batch.x.size();
+            if (!isValidTofRow(tofMatrix, row))
+            {
+                batch.status[row] = TrilaterationStatus::InvalidTof;
+                continue;
+            }
+            if (basis.status != TrilaterationStatus::Ok)
+            {
+                batch.status[row] = basis.status;
+                continue;
+            }
 
-        // Calculate both possible solutions
-        Vector resultVec1 = (ex * x) + (ey * y) + (ez * z);
-        Vector resultVec2 = (ex * x) + (ey * y) + (ez * (-z));
+            // The first-echo hypothesis is always solved, exactly as with a single echo
+            if (!solveHypothesis(tofMatrix(row, 0), tofMatrix(row, 1), tofMatrix(row, 2), tofMatrix(row, 3)))
+            {
+                batch.status[row] = TrilaterationStatus::NoRealSolution;
+            }
+            if (echoes == 1)
+            {
+                continue;
+            }
 
-        Point result1 = c1 + resultVec1;
-        Point result2 = c1 + resultVec2;
+            // Further hypotheses: one echo per receiver. Echoes of one reflector differ by at most
+            // the receivers' baseline, so inconsistent prefixes are cut before the inner loops.
+            std::array<size_t, REQUIRED_RECEIVER_COUNT> available{};
+            for (size_t rx = 0; rx < REQUIRED_RECEIVER_COUNT; ++rx)
+            {
+                while (available[rx] < echoes && tofMatrix(row, rx, available[rx]) > EPSILON)
+                {
+                    ++available[rx];
+                }
+            }
+            const auto consistent = [&](size_t a, float tofA, size_t b, float tofB)
+            {
+                return std::abs(tofA - tofB) <= basis.baselines[a][b] + CONSISTENCY_TOLERANCE;
+            };
 
-        return std::make_pair(result1, result2);
+            for (size_t e0 = 0; e0 < available[0]; ++e0)
+            {
+                const float t0 = tofMatrix(row, 0, e0);
+                for (size_t e1 = 0; e1 < available[1]; ++e1)
+                {
+                    const float t1 = tofMatrix(row, 1, e1);
+                    if (!consistent(0, t0, 1, t1))
+                    {
+                        continue;
+                    }
+                    for (size_t e2 = 0; e2 < available[2]; ++e2)
+                    {
+                        const float t2 = tofMatrix(row, 2, e2);
+                        if (!consistent(0, t0, 2, t2) || !consistent(1, t1, 2, t2))
+                        {
+                            continue;
+                        }
+                        for (size_t e3 = 0; e3 < available[3]; ++e3)
+                        {
+                            const float t3 = tofMatrix(row, 3, e3);
+                            if ((e0 | e1 | e2 | e3) == 0 ||
+                                !consistent(0, t0, 3, t3) || !consistent(1, t1, 3, t3) || !consistent(2, t2, 3, t3))
+                            {
+                                continue; // first-echo hypothesis already solved, or inconsistent
+                            }
+                            solveHypothesis(t0, t1, t2, t3);
+                        }
+                    }
+                }
+            }
+        }
+        batch.begin[rows] = batch.x.size();
     }
 
-    std::shared_ptr<math::PointCloud> SignalSolver::solveAdsilTrilateration(const TofMatrix &tofMatrix)
+    std::shared_ptr<math::PointCloud> SignalSolver::solveAdsilTrilateration(const SceneSnapshot &scene, const TofMatrix &tofMatrix)
     {
         auto result = std::make_shared<PointCloud>();
 
@@ -213,48 +552,59 @@ namespace simulation
             throw std::runtime_error("ADSIL requires exactly 4 receivers");
         }
 
-        const auto &transmitters = scene_->getTransmitters();
-        const auto &receivers = scene_->getReceivers();
+        const auto &transmitters = scene.transmitters;
+
+        // The receiver frame is shared by every row; solve all rows against it at once
+        const ReceiverBasis &basis = receiverBasis(scene.rxFrusta);
+        trilaterateRows(tofMatrix, basis, batch_);
 
+        // Batched FOV check: every candidate against its transmitter's frustum
+        batch_.inFov.assign(batch_.x.size(), 0);
         for (size_t txIndex = 0; txIndex < tofMatrix.txCount; ++txIndex)
         {
-            if (!isValidTofRow(tofMatrix, txIndex))
+            if (batch_.begin[txIndex] == batch_.begin[txIndex + 1])
             {
-                continue; // Skip invalid ToF measurements
+                continue;
             }
-
-            try
+            const auto &frustum = scene.txFrusta[txIndex];
+            for (size_t k = batch_.begin[txIndex]; k < batch_.begin[txIndex + 1]; ++k)
             {
-                auto [point1, point2] = calculateAdsilPositions(tofMatrix, txIndex, receivers);
-
-                // Create possible solutions
-                auto possiblePoints = std::make_shared<PointCloud>();
-                possiblePoints->addPoint(point1);
-                possiblePoints->addPoint(point2);
-
-                // Filter by transmitter FOV to get valid solutions
-                auto validSolutions = transmitters[txIndex]->pointsInFov(*possiblePoints);
-
-                if (validSolutions && !validSolutions->empty())
-                {
-                    for (const auto &point : validSolutions->getPoints())
-                    {
-                        LOGGER_INFO("simulation", "From Transmitter: " + transmitters[txIndex]->getName());
-                        LOGGER_INFO("simulation", "Detected ADSIL point: " + point.toString());
+                batch_.inFov[k] = frustum->contains(Point(batch_.x[k], batch_.y[k], batch_.z[k])) ? 1 : 0;
+            }
+        }
 
-                        // Export point to CSV
-                        utils::DataExporter::getInstance().exportPoint(
-                            transmitters[txIndex]->getName(),
-                            point.x(), point.y(), point.z());
-                    }
-                    result->addPoints(validSolutions->getPoints());
-                }
+        // Single merge in transmitter order keeps logs, exports and the result deterministic
+        for (size_t txIndex = 0; txIndex < tofMatrix.txCount; ++txIndex)
+        {
+            const auto status = batch_.status[txIndex];
+            if (status == TrilaterationStatus::InvalidTof)
+            {
+                continue; // Skip invalid ToF measurements
             }
-            catch (const std::runtime_error &e)
+            if (status != TrilaterationStatus::Ok)
             {
-                // Log error and continue with next transmitter
+                // Log why the first-echo hypothesis failed; further echo combinations may still yield points
                 LOGGER_INFO("simulation", "Skipping transmitter " + transmitters[txIndex]->getName() +
-                                              ": " + std::string(e.what()));
+                                              ": " + toString(status));
+            }
+
+            // Candidates of the first-echo hypothesis come first, then further echo combinations
+            for (size_t k = batch_.begin[txIndex]; k < batch_.begin[txIndex + 1]; ++k)
+            {
+                if (!batch_.inFov[k])
+                {
+                    continue;
+                }
+
+                const Point point(batch_.x[k], batch_.y[k], batch_.z[k]);
+                LOGGER_INFO("simulation", "From Transmitter: " + transmitters[txIndex]->getName());
+                LOGGER_INFO("simulation", "Detected ADSIL point: " + point.toString());
+
+                // Export point to CSV
+                utils::DataExporter::getInstance().exportPoint(
+                    transmitters[txIndex]->getName(),
+                    point.x(), point.y(), point.z());
+                result->addPoint(point);
             }
         }
 
@@ -1,6 +1,8 @@
 #include <simulation/implementations/SimulationManager.hpp>
+#include <algorithm>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 
 // Fallback base resource directory if environment variable is not set
@@ -65,8 +67,12 @@ namespace simulation
         scene_ = adapters_->fromJson<std::shared_ptr<SimulationScene>>(
             core::ResourceLocator::getJsonPath("scene.json"));
 
-        // Initialize frame buffer with configured window size
-        frameBuffer_ = std::make_shared<FrameBufferManager>(frameConfig.bufferWindowSize);
+        // Initialize frame buffer with configured window size, cache budget and prefetching
+        frameBuffer_ = std::make_shared<FrameBufferManager>(
+            frameConfig.bufferWindowSize,
+            static_cast<std::size_t>(std::max(0, frameConfig.cacheBudgetMB)) * 1024u * 1024u,
+            frameConfig.prefetchDepth,
+            static_cast<std::size_t>(std::max(0, frameConfig.ioThreads)));
 
         // Initialize the OpenGL viewer with configured parameters
         const auto &windowConfig = config_->getWindowConfig();
@@ -81,7 +87,12 @@ namespace simulation
         inputManager_ = std::make_shared<simulation::InputManager>(viewer_->getInputManager());
 
         // Initialize the signal solver (sensor signal processing, etc.)
-        signalSolver_ = std::make_shared<simulation::SignalSolver>(scene_);
+        const auto &solverConfig = config_->getSolverConfig();
+        auto signalSolver = std::make_shared<simulation::SignalSolver>(
+            scene_, static_cast<std::size_t>(std::max(0, solverConfig.workerThreads)));
+        signalSolver->setEchoCount(static_cast<std::size_t>(
+            std::clamp(solverConfig.echoesPerPair, 1, static_cast<int>(simulation::SignalSolver::MAX_ECHOES))));
+        signalSolver_ = signalSolver;
 
         // Register this manager as a frame observer
         frameBuffer_->addFrameObserver(shared_from_this());
@@ -292,6 +303,9 @@ namespace simulation
         // Set frame context for data export
         utils::DataExporter::getInstance().setFrameContext(frameIdx, ts);
 
+        // Device poses live in the scene graph, which only this thread may touch
+        signalSolver_->prepare();
+
         // Run signal processing in background thread
         std::thread([this, ts, frameIdx, totalFrames]()
                     {
@@ -303,8 +317,7 @@ namespace simulation
                 TIMER_SCOPE("SignalProcessing_Total");
 
                 std::shared_ptr<math::PointCloud> pointCloud;
-                core::Timer::measure("SignalSolver_solve", [&]()
-                                     { pointCloud = signalSolver_->solve(); });
+                TIMER_MEASURE("SignalSolver_solve", pointCloud = signalSolver_->solve());
 
                 // Store result for main thread
                 {
@@ -337,8 +350,7 @@ namespace simulation
 
         if (pointCloud && detectedPointCloudEntity_)
         {
-            core::Timer::measure("PointCloudEntity_setPointCloud", [&]()
-                                 { detectedPointCloudEntity_->setPointCloud(pointCloud); });
+            TIMER_MEASURE("PointCloudEntity_setPointCloud", detectedPointCloudEntity_->setPointCloud(pointCloud));
         }
     }
 
@@ -359,9 +371,18 @@ namespace simulation
             simOutputLogger.setLogFile(core::ResourceLocator::getLoggingPath("simulation.log"));
             simOutputLogger.clearLog();
 
-            // Initialize data exporter for CSV output
+            // Log formatting and file writes run on a background thread; ADSIL_LOG_ASYNC=0 keeps them inline
+            const char *asyncLogEnv = std::getenv("ADSIL_LOG_ASYNC");
+            if (!asyncLogEnv || std::string(asyncLogEnv) != "0")
+            {
+                core::Logger::startAsync();
+            }
+
+            // Initialize data exporter (CSV, or .adsdet when configured)
             auto &exporter = utils::DataExporter::getInstance();
             exporter.init(core::ResourceLocator::getExportPath());
+            exporter.setFormat(config_->getExportConfig().binary ? utils::DataExporter::Format::Binary
+                                                                 : utils::DataExporter::Format::Csv);
             exporter.startSession();
             LOGGER_INFO(LogChannel, "Data exporter initialized: " + exporter.getCurrentFilePath());
 
@@ -424,6 +445,7 @@ namespace simulation
             LOGGER_INFO(LogChannel, "Simulation loop ended, cleaning up...");
             utils::DataExporter::getInstance().endSession();
             viewer_->cleanup();
+            core::Logger::stopAsync();
         }
         catch (const std::exception &e)
         {
@@ -431,6 +453,7 @@ namespace simulation
             {
                 viewer_->cleanup();
             }
+            core::Logger::stopAsync();
             throw std::runtime_error("SimulationManager error: " + std::string(e.what()));
         }
     }
@@ -511,6 +534,16 @@ namespace simulation
                 double solverPercentage = (signalSolverStats.averageMs() / frameStats.averageMs()) * 100.0;
                 LOGGER_INFO(LogChannel, "  - Signal solver: " + std::to_string(solverPercentage) + "% of frame time");
             }
+
+            if (auto solver = std::dynamic_pointer_cast<simulation::SignalSolver>(signalSolver_))
+            {
+                const auto arenaStats = solver->getLastArenaStats();
+                // Only the solver's per-solve scratch goes through the arena; the result cloud
+                // and the state kept between solves are ordinary heap allocations
+                LOGGER_INFO(LogChannel, "  - Arena scratch (last solve): " + std::to_string(arenaStats.allocations) +
+                                            " allocations, " + std::to_string(arenaStats.bytes / 1024) + " KB, " +
+                                            std::to_string(arenaStats.overflowBuffers) + " overflow buffers");
+            }
         }
 
         if (updateStats.count > 0 && renderStats.count > 0)
@@ -11,6 +11,7 @@ SimulationScene::SimulationScene()
 
 void SimulationScene::addShape(std::shared_ptr<ShapeBase> shape)
 {
+    std::lock_guard<std::mutex> lock(cloudMutex_);
     shapes_.push_back(std::move(shape));
     // Invalidate cache when scene content changes
     mergedCacheDirty_ = true;
@@ -18,6 +19,7 @@ void SimulationScene::addShape(std::shared_ptr<ShapeBase> shape)
 
 void SimulationScene::setShapes(SharedVec<ShapeBase> shapes)
 {
+    std::lock_guard<std::mutex> lock(cloudMutex_);
     shapes_ = shapes;
     mergedCacheDirty_ = true;
 }
@@ -53,8 +55,9 @@ bool SimulationScene::hasCar() const
 {
     return static_cast<bool>(car_);
 }
-std::shared_ptr<math::PointCloud> SimulationScene::getMergedPointCloud(int quality) const
+std::shared_ptr<const math::PointCloud> SimulationScene::getMergedPointCloud(int quality) const
 {
+    std::lock_guard<std::mutex> lock(cloudMutex_);
     // Prefer external cloud only if it has data; otherwise synthesize from shapes
     if (externalCloud_ && !externalCloud_->empty())
     {
@@ -63,12 +66,47 @@ std::shared_ptr<math::PointCloud> SimulationScene::getMergedPointCloud(int quali
     return mergedShapePointCloud(quality);
 }
 
+std::shared_ptr<const math::PointKdTree> SimulationScene::getMergedPointIndex(int quality) const
+{
+    return getPointIndex(getMergedPointCloud(quality));
+}
+
+std::shared_ptr<const math::PointKdTree> SimulationScene::getPointIndex(const std::shared_ptr<const math::PointCloud> &cloud,
+                                                                       core::ThreadPool *pool) const
+{
+    if (!cloud)
+    {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(cloudMutex_);
+        // indexCloud_ keeps the indexed cloud alive, so a new cloud can never reuse its address
+        if (indexCache_ && indexCloud_ == cloud)
+        {
+            return indexCache_;
+        }
+    }
+
+    // Build without the lock so frame swaps and other readers are not held up by it
+    auto index = std::make_shared<const math::PointKdTree>(*cloud, pool);
+
+    std::lock_guard<std::mutex> lock(cloudMutex_);
+    if (indexCache_ && indexCloud_ == cloud)
+    {
+        return indexCache_; // Another reader built the same index meanwhile
+    }
+    indexCache_ = index;
+    indexCloud_ = cloud;
+    return index;
+}
+
 std::shared_ptr<math::PointCloud> SimulationScene::mergedShapePointCloud(int quality) const
 {
     // Simple cache to avoid re-generating merged cloud every call if shapes/quality unchanged
     if (!mergedCacheDirty_ && mergedCache_ && lastQuality_ == quality)
     {
-        LOGGER_INFO("Using cached merged point cloud");
+        LOGGER_DEBUG_EVERY_MS(1000, "Using cached merged point cloud");
         return mergedCache_;
     }
 
@@ -100,26 +138,29 @@ void SimulationScene::overrideTimestamp(double ts)
     timestamp_ = ts;
 }
 
-void SimulationScene::setExternalPointCloud(std::shared_ptr<math::PointCloud> cloud)
+void SimulationScene::setExternalPointCloud(std::shared_ptr<const math::PointCloud> cloud)
 {
-    *externalCloud_ = *cloud; // ✅ overwrite contents, not pointer
+    // Swap the pointer: readers holding the previous frame keep it; nothing is copied
+    std::lock_guard<std::mutex> lock(cloudMutex_);
+    externalCloud_ = cloud ? std::move(cloud) : std::make_shared<math::PointCloud>();
     // External stream takes precedence; cache isn't useful while external data exists
 }
 
-std::shared_ptr<math::PointCloud> SimulationScene::getExternalPointCloud() const
+std::shared_ptr<const math::PointCloud> SimulationScene::getExternalPointCloud() const
 {
+    std::lock_guard<std::mutex> lock(cloudMutex_);
     return externalCloud_;
 }
 
 void SimulationScene::onFrameChanged(const std::shared_ptr<simulation::Frame> &frame)
 {
-    LOGGER_INFO("SimulationScene received frame change notification");
+    LOGGER_INFO_EVERY_MS(1000, "SimulationScene received frame change notification");
     if (!frame)
     {
         LOGGER_WARN("SimulationScene: Received empty frame");
         return;
     }
-    LOGGER_INFO("External point cloud updated with frame data");
+    LOGGER_INFO_EVERY_MS(1000, "External point cloud updated with frame data");
     setExternalPointCloud(frame->cloud);
     // overrideTimestamp(frame->timestamp);
 }
\ No newline at end of file
@@ -25,6 +25,14 @@ namespace simulation
             throw std::runtime_error(err_msg + "\n" + info_msg);
         }
 
+        const char *exportFormatEnv = std::getenv("ADSIL_EXPORT_FORMAT");
+        if (exportFormatEnv && std::string(exportFormatEnv) == "binary")
+        {
+            ExportConfig exportConfig = config->getExportConfig();
+            exportConfig.binary = true;
+            config->setExportConfig(exportConfig);
+        }
+
         return config;
     }
 
@@ -0,0 +1,147 @@
+// Unit tests for the binary ADSF frame format.
+
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static simulation::Frame makeFrame(std::size_t pointCount)
+{
+    simulation::Frame frame;
+    frame.frameId = 42;
+    frame.timestamp = 1746466084.1829212;
+    frame.linearAcceleration = {0.0023f, 0.0011f, 0.0981f};
+    frame.angularVelocity = {-0.5f, 0.25f, 0.0f};
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        const float t = static_cast<float>(i);
+        cloud->addPoint(math::Point(38.885f + t, 17.952f - t * 0.5f, 5.775f + t * 0.125f));
+    }
+    frame.cloud = cloud;
+    return frame;
+}
+
+static bool sameFrame(const simulation::Frame &a, const simulation::Frame &b)
+{
+    bool same = a.frameId == b.frameId && a.timestamp == b.timestamp &&
+                a.linearAcceleration == b.linearAcceleration && a.angularVelocity == b.angularVelocity &&
+                a.cloud->size() == b.cloud->size();
+    for (std::size_t i = 0; same && i < a.cloud->size(); ++i)
+    {
+        const auto &p = a.cloud->getPoints()[i];
+        const auto &q = b.cloud->getPoints()[i];
+        same = p.x() == q.x() && p.y() == q.y() && p.z() == q.z();
+    }
+    return same;
+}
+
+void testEncodeDecodeRoundTrip()
+{
+    std::cout << "\n=== testEncodeDecodeRoundTrip ===" << std::endl;
+    const auto frame = makeFrame(1000);
+    const auto bytes = simulation::FrameBinaryCodec::encode(frame);
+
+    SimpleTest::assert_true(bytes.size() == simulation::FrameBinaryCodec::HEADER_SIZE + 1000 * 12,
+                            "Encoded size is header plus 12 bytes per point");
+    const auto decoded = simulation::FrameBinaryCodec::decode(bytes.data(), bytes.size());
+    SimpleTest::assert_true(sameFrame(frame, *decoded), "Decoded frame matches bit for bit");
+}
+
+void testEmptyFrame()
+{
+    std::cout << "\n=== testEmptyFrame ===" << std::endl;
+    simulation::Frame frame; // no cloud at all
+    const auto bytes = simulation::FrameBinaryCodec::encode(frame);
+    const auto decoded = simulation::FrameBinaryCodec::decode(bytes.data(), bytes.size());
+    SimpleTest::assert_true(decoded->cloud && decoded->cloud->empty(), "Frame without points decodes to an empty cloud");
+    SimpleTest::assert_true(decoded->frameId == -1, "Unknown frame id is preserved");
+}
+
+void testFileRoundTrip()
+{
+    std::cout << "\n=== testFileRoundTrip ===" << std::endl;
+    const auto path = (std::filesystem::temp_directory_path() / "adsil_frame_codec_test.adsf").string();
+    const auto frame = makeFrame(257);
+
+    simulation::FrameBinaryCodec::writeFile(frame, path);
+    const auto loaded = simulation::FrameBinaryCodec::readFile(path);
+    SimpleTest::assert_true(sameFrame(frame, *loaded), "File round trip preserves the frame");
+    SimpleTest::assert_true(loaded->filePath == path, "Loaded frame records its file path");
+    std::filesystem::remove(path);
+}
+
+static bool decodeThrows(const std::vector<std::uint8_t> &bytes)
+{
+    try
+    {
+        (void)simulation::FrameBinaryCodec::decode(bytes.data(), bytes.size());
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+void testRejectsMalformedInput()
+{
+    std::cout << "\n=== testRejectsMalformedInput ===" << std::endl;
+    const auto good = simulation::FrameBinaryCodec::encode(makeFrame(10));
+
+    auto badMagic = good;
+    badMagic[0] = '{';
+    SimpleTest::assert_true(decodeThrows(badMagic), "Wrong magic is rejected");
+
+    auto badVersion = good;
+    badVersion[4] = 99;
+    SimpleTest::assert_true(decodeThrows(badVersion), "Unknown version is rejected");
+
+    auto truncated = good;
+    truncated.resize(truncated.size() - 5);
+    SimpleTest::assert_true(decodeThrows(truncated), "Truncated point data is rejected");
+
+    std::vector<std::uint8_t> tiny(good.begin(), good.begin() + 20);
+    SimpleTest::assert_true(decodeThrows(tiny), "Truncated header is rejected");
+}
+
+int main()
+{
+    std::cout << "FrameBinaryCodec Test Suite" << std::endl;
+    std::cout << "===========================" << std::endl;
+
+    testEncodeDecodeRoundTrip();
+    testEmptyFrame();
+    testFileRoundTrip();
+    testRejectsMalformedInput();
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
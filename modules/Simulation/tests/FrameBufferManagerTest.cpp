@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 #include <functional>
+#include <deque>
 
 // Simple test framework
 class SimpleTest
@@ -36,7 +37,7 @@ public:
         assert_true(!condition, message);
     }
 
-    static void assert_not_null(void *ptr, const std::string &message)
+    static void assert_not_null(const void *ptr, const std::string &message)
     {
         if (ptr == nullptr)
         {
@@ -49,7 +50,7 @@ public:
         }
     }
 
-    static void assert_null(void *ptr, const std::string &message)
+    static void assert_null(const void *ptr, const std::string &message)
     {
         if (ptr != nullptr)
         {
@@ -251,8 +252,7 @@ void testMultipleObservers()
 
     auto frame = std::make_shared<simulation::Frame>();
     frame->timestamp = 100.0;
-    frame->cloud = std::make_shared<math::PointCloud>();
-    frame->cloud->addPoint(math::Point(0, 0, 0));
+    frame->cloud = std::make_shared<math::PointCloud>(std::vector<math::Point>{math::Point(0, 0, 0)});
 
     // Notify all observers
     for (auto &obs : observers)
@@ -326,8 +326,7 @@ void testFrameClearMultipleTimes()
     SimpleTest::assert_true(true, "Clear on empty frame succeeds");
 
     // Set data and clear
-    frame->cloud = std::make_shared<math::PointCloud>();
-    frame->cloud->addPoint(math::Point(1, 2, 3));
+    frame->cloud = std::make_shared<math::PointCloud>(std::vector<math::Point>{math::Point(1, 2, 3)});
     frame->timestamp = 10.0;
     frame->filePath = "test.json";
 
@@ -0,0 +1,167 @@
+// Tests for FrameBufferManager's asynchronous seek, run against a small frame pack on disk.
+
+#include <simulation/implementations/FrameBufferManager.hpp>
+#include <simulation/implementations/FramePack.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <simulation/interfaces/IFrameObserver.hpp>
+#include <core/ResourceLocator.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+class RecordingObserver : public simulation::IFrameObserver
+{
+public:
+    void onFrameChanged(const std::shared_ptr<simulation::Frame> &frame) override
+    {
+        calls++;
+        lastFrameId = frame ? frame->frameId : -1;
+    }
+
+    int calls = 0;
+    int lastFrameId = -1;
+};
+
+static const int FRAME_COUNT = 60;
+
+// Writes <tmp>/extracted_frames_json/frames.adspack and points the ResourceLocator at it
+static std::filesystem::path makeRecording()
+{
+    const auto base = std::filesystem::temp_directory_path() / "adsil_frame_seek_test";
+    const auto frameDir = base / "extracted_frames_json";
+    std::filesystem::remove_all(base);
+    std::filesystem::create_directories(frameDir);
+
+    simulation::FramePackWriter writer((frameDir / simulation::FramePack::DEFAULT_FILE_NAME).string());
+    for (int i = 0; i < FRAME_COUNT; ++i)
+    {
+        simulation::Frame frame;
+        frame.frameId = i;
+        frame.timestamp = 100.0 + i * 0.1;
+        auto cloud = std::make_shared<math::PointCloud>();
+        for (int p = 0; p < 20000; ++p)
+            cloud->addPoint(math::Point(static_cast<float>(p), static_cast<float>(i), 0.0f));
+        frame.cloud = cloud;
+        writer.append(frame);
+    }
+    writer.finish();
+
+    core::ResourceLocator::setBasePath(base.string());
+    return base;
+}
+
+// Drives update() like the render loop until the seek completes
+static bool pumpUntilSeekDone(simulation::FrameBufferManager &buffer)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (buffer.isSeeking())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        buffer.update(0.0f);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+void testSeekCompletesThroughUpdate()
+{
+    std::cout << "\n=== testSeekCompletesThroughUpdate ===" << std::endl;
+    simulation::FrameBufferManager buffer(1, simulation::FrameCache::DEFAULT_BUDGET_BYTES, 2, 1);
+    auto observer = std::make_shared<RecordingObserver>();
+    buffer.addFrameObserver(observer);
+    SimpleTest::assert_true(buffer.getTotalFrameCount() == FRAME_COUNT, "Frame count comes from the pack");
+
+    buffer.seek(40);
+    if (buffer.isSeeking())
+    {
+        SimpleTest::assert_true(buffer.getCurrentFrameIndex() == 0 && observer->calls == 0,
+                                "Previous frame stays current while the target loads");
+    }
+    SimpleTest::assert_true(pumpUntilSeekDone(buffer), "Seek completes");
+    SimpleTest::assert_true(buffer.getCurrentFrameIndex() == 40 && buffer.getCurrentFrame()->frameId == 40,
+                            "Target frame is current");
+    SimpleTest::assert_true(observer->calls == 1 && observer->lastFrameId == 40, "Observers notified once with the target");
+
+    const auto stats = buffer.getSeekStats();
+    SimpleTest::assert_true(stats.count == 1 && stats.lastMs >= 0.0 && stats.maxMs == stats.lastMs, "Seek latency recorded");
+}
+
+void testCachedSeekIsImmediate()
+{
+    std::cout << "\n=== testCachedSeekIsImmediate ===" << std::endl;
+    simulation::FrameBufferManager buffer(1, simulation::FrameCache::DEFAULT_BUDGET_BYTES, 2, 1);
+    buffer.seek(30);
+    SimpleTest::assert_true(pumpUntilSeekDone(buffer), "First seek completes");
+
+    buffer.seek(0); // frame 0 was loaded by the constructor and is still cached
+    SimpleTest::assert_true(!buffer.isSeeking() && buffer.getCurrentFrameIndex() == 0, "Cached target is shown inside seek()");
+    SimpleTest::assert_true(buffer.getSeekStats().count == 2, "Both seeks measured");
+}
+
+void testStepReplacesPendingSeek()
+{
+    std::cout << "\n=== testStepReplacesPendingSeek ===" << std::endl;
+    simulation::FrameBufferManager buffer(1, simulation::FrameCache::DEFAULT_BUDGET_BYTES, 2, 1);
+    buffer.seek(50);
+    buffer.stepForward();
+    SimpleTest::assert_true(!buffer.isSeeking() && buffer.getCurrentFrameIndex() == 1, "Step wins over an unfinished seek");
+
+    buffer.seek(-1);
+    buffer.seek(FRAME_COUNT);
+    SimpleTest::assert_true(!buffer.isSeeking() && buffer.getCurrentFrameIndex() == 1, "Out-of-range seeks are ignored");
+}
+
+void testPlaybackWaitsForSeek()
+{
+    std::cout << "\n=== testPlaybackWaitsForSeek ===" << std::endl;
+    simulation::FrameBufferManager buffer(1, simulation::FrameCache::DEFAULT_BUDGET_BYTES, 2, 1);
+    buffer.play();
+    buffer.seek(20);
+    SimpleTest::assert_true(pumpUntilSeekDone(buffer), "Seek completes while playing");
+    SimpleTest::assert_true(buffer.getCurrentFrameIndex() == 20, "Playback did not advance past the pending seek");
+
+    buffer.update(1.0f); // one playback interval
+    SimpleTest::assert_true(buffer.getCurrentFrameIndex() == 21, "Playback continues from the seek target");
+}
+
+int main()
+{
+    std::cout << "FrameBuffer Seek Test Suite" << std::endl;
+    std::cout << "===========================" << std::endl;
+
+    const auto base = makeRecording();
+    testSeekCompletesThroughUpdate();
+    testCachedSeekIsImmediate();
+    testStepReplacesPendingSeek();
+    testPlaybackWaitsForSeek();
+    std::filesystem::remove_all(base);
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
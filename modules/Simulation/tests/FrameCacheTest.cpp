@@ -0,0 +1,153 @@
+// Unit tests for the byte-budgeted LRU frame cache.
+
+#include <simulation/implementations/FrameCache.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static std::shared_ptr<simulation::Frame> makeFrame(int index, std::size_t pointCount = 100)
+{
+    auto frame = std::make_shared<simulation::Frame>();
+    frame->frameId = index;
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (std::size_t i = 0; i < pointCount; ++i)
+    {
+        cloud->addPoint(math::Point(static_cast<float>(i), 0.0f, 0.0f));
+    }
+    frame->cloud = cloud;
+    return frame;
+}
+
+void testHitsAndMisses()
+{
+    std::cout << "\n=== testHitsAndMisses ===" << std::endl;
+    simulation::FrameCache cache;
+    auto frame = makeFrame(3);
+    cache.put(3, frame);
+
+    SimpleTest::assert_true(cache.get(3) == frame, "Cached frame is returned as the same object");
+    SimpleTest::assert_true(cache.get(4) == nullptr, "Unknown index misses");
+    SimpleTest::assert_true(cache.contains(3) && !cache.contains(4), "contains() reports cached indices");
+
+    const auto stats = cache.getStats();
+    SimpleTest::assert_true(stats.hits == 1 && stats.misses == 1, "One hit and one miss counted (contains() not counted)");
+    SimpleTest::assert_true(stats.entries == 1 && stats.bytes == simulation::FrameCache::frameBytes(*frame),
+                            "Size accounting matches frameBytes()");
+}
+
+void testEvictsLeastRecentlyUsed()
+{
+    std::cout << "\n=== testEvictsLeastRecentlyUsed ===" << std::endl;
+    const std::size_t frameSize = simulation::FrameCache::frameBytes(*makeFrame(0));
+    simulation::FrameCache cache(3 * frameSize); // room for exactly three frames
+
+    cache.put(0, makeFrame(0));
+    cache.put(1, makeFrame(1));
+    cache.put(2, makeFrame(2));
+    (void)cache.get(0);         // 0 becomes most recently used, 1 is now the oldest
+    cache.put(3, makeFrame(3)); // over budget: evicts 1
+
+    SimpleTest::assert_true(!cache.contains(1), "Least recently used frame was evicted");
+    SimpleTest::assert_true(cache.contains(0) && cache.contains(2) && cache.contains(3), "Recently used frames stay");
+    SimpleTest::assert_true(cache.getStats().evictions == 1, "Eviction counted");
+    SimpleTest::assert_true(cache.getStats().bytes <= 3 * frameSize, "Cache stays within its budget");
+
+    cache.setBudget(frameSize);
+    SimpleTest::assert_true(cache.getStats().entries == 1 && cache.contains(3), "Shrinking the budget keeps the newest frame");
+}
+
+void testOversizedFrameIsKept()
+{
+    std::cout << "\n=== testOversizedFrameIsKept ===" << std::endl;
+    simulation::FrameCache cache(16); // smaller than any frame
+    cache.put(0, makeFrame(0));
+    cache.put(1, makeFrame(1));
+    SimpleTest::assert_true(cache.contains(1) && !cache.contains(0), "Newest frame stays even above the budget");
+}
+
+void testScrubbingHitsCache()
+{
+    std::cout << "\n=== testScrubbingHitsCache ===" << std::endl;
+    simulation::FrameCache cache;
+    for (int i = 0; i < 20; ++i)
+    {
+        cache.put(i, makeFrame(i));
+    }
+
+    // Back-and-forth over recently viewed frames never misses
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        for (int i = 19; i >= 0; --i)
+            (void)cache.get(i);
+        for (int i = 0; i < 20; ++i)
+            (void)cache.get(i);
+    }
+    const auto stats = cache.getStats();
+    SimpleTest::assert_true(stats.hits == 120 && stats.misses == 0, "Scrubbing within the budget only hits");
+}
+
+void testConcurrentAccess()
+{
+    std::cout << "\n=== testConcurrentAccess ===" << std::endl;
+    const std::size_t frameSize = simulation::FrameCache::frameBytes(*makeFrame(0, 10));
+    simulation::FrameCache cache(8 * frameSize);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&cache, t]
+                             {
+            for (int i = 0; i < 500; ++i)
+            {
+                const int index = (i * 7 + t) % 32;
+                if (!cache.get(index))
+                    cache.put(index, makeFrame(index, 10));
+            } });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    const auto stats = cache.getStats();
+    SimpleTest::assert_true(stats.hits + stats.misses == 2000, "Every lookup counted once");
+    SimpleTest::assert_true(stats.bytes <= 8 * frameSize && stats.entries <= 8, "Budget holds under concurrent inserts");
+}
+
+int main()
+{
+    std::cout << "FrameCache Test Suite" << std::endl;
+    std::cout << "=====================" << std::endl;
+
+    testHitsAndMisses();
+    testEvictsLeastRecentlyUsed();
+    testOversizedFrameIsKept();
+    testScrubbingHitsCache();
+    testConcurrentAccess();
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
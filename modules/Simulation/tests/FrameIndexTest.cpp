@@ -0,0 +1,211 @@
+// Tests for FrameIndex: sidecar build, reuse and invalidation, nearest-timestamp lookup, unreadable
+// frames and packs.
+
+#include <simulation/implementations/FrameIndex.hpp>
+#include <simulation/implementations/FrameBinaryCodec.hpp>
+#include <simulation/implementations/FramePack.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static const int FRAME_COUNT = 12;
+
+static std::shared_ptr<simulation::Frame> readFrame(const std::string &path)
+{
+    return simulation::FrameBinaryCodec::readFile(path);
+}
+
+static simulation::Frame makeFrame(int id, int points)
+{
+    simulation::Frame frame;
+    frame.frameId = id;
+    frame.timestamp = 50.0 + id * 0.1;
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (int p = 0; p < points; ++p)
+        cloud->addPoint(math::Point(static_cast<float>(p), static_cast<float>(id), 0.0f));
+    frame.cloud = cloud;
+    return frame;
+}
+
+static std::string frameFile(const fs::path &dir, int id)
+{
+    char name[32];
+    std::snprintf(name, sizeof(name), "frame_%05d", id);
+    return (dir / (std::string(name) + simulation::FrameBinaryCodec::EXTENSION)).string();
+}
+
+static fs::path makeFolder()
+{
+    const auto dir = fs::temp_directory_path() / "adsil_frame_index_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    for (int i = 0; i < FRAME_COUNT; ++i)
+        simulation::FrameBinaryCodec::writeFile(makeFrame(i, 10 + i), frameFile(dir, i));
+    return dir;
+}
+
+void testBuildWritesSidecar()
+{
+    std::cout << "\n=== Testing first load builds and saves the index ===" << std::endl;
+
+    const auto dir = makeFolder();
+    std::atomic<int> loads{0};
+    const auto loader = [&](const std::string &path)
+    {
+        loads++;
+        return simulation::FrameBinaryCodec::readFile(path);
+    };
+
+    const auto index = simulation::FrameIndex::loadOrBuild(dir.string(), loader);
+    SimpleTest::assert_true(index.size() == FRAME_COUNT, "Every frame file is indexed");
+    SimpleTest::assert_true(loads == FRAME_COUNT, "Each frame is parsed once");
+    SimpleTest::assert_true(!index.isFromSidecar(), "First load is a rebuild");
+    SimpleTest::assert_true(fs::exists(dir / simulation::FrameIndex::SIDECAR_FILE_NAME), "Sidecar is written");
+
+    const auto &entry = index.entry(3);
+    SimpleTest::assert_true(entry.path == frameFile(dir, 3), "Entries are in frame order");
+    SimpleTest::assert_true(entry.pointCount == 13 && entry.frameId == 3, "Point count and frame id are recorded");
+    SimpleTest::assert_true(entry.byteSize == fs::file_size(entry.path), "File size is recorded");
+}
+
+void testSidecarReused()
+{
+    std::cout << "\n=== Testing an unchanged folder loads from the sidecar ===" << std::endl;
+
+    const fs::path dir = fs::temp_directory_path() / "adsil_frame_index_test";
+    int loads = 0;
+    const auto index = simulation::FrameIndex::loadOrBuild(dir.string(), [&](const std::string &path)
+                                                           { loads++; return simulation::FrameBinaryCodec::readFile(path); });
+
+    SimpleTest::assert_true(index.isFromSidecar(), "Sidecar is used");
+    SimpleTest::assert_true(loads == 0, "No frame is parsed");
+    SimpleTest::assert_true(index.size() == FRAME_COUNT, "Frame count survives the round trip");
+    SimpleTest::assert_true(index.entry(7).timestamp == 50.0 + 7 * 0.1, "Timestamps survive the round trip");
+    SimpleTest::assert_true(index.entry(7).path == frameFile(dir, 7), "Paths are resolved against the folder");
+}
+
+void testChangedFrameRebuilds()
+{
+    std::cout << "\n=== Testing a rewritten frame invalidates the sidecar ===" << std::endl;
+
+    const fs::path dir = fs::temp_directory_path() / "adsil_frame_index_test";
+    simulation::FrameBinaryCodec::writeFile(makeFrame(4, 500), frameFile(dir, 4));
+
+    const auto rebuilt = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(!rebuilt.isFromSidecar(), "Changed file size forces a rebuild");
+    SimpleTest::assert_true(rebuilt.entry(4).pointCount == 500, "Rebuild picks up the new frame");
+
+    simulation::FrameBinaryCodec::writeFile(makeFrame(FRAME_COUNT, 10), frameFile(dir, FRAME_COUNT));
+    const auto grown = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(!grown.isFromSidecar(), "Added frame forces a rebuild");
+    SimpleTest::assert_true(grown.size() == FRAME_COUNT + 1, "Added frame is indexed");
+
+    const auto again = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(again.isFromSidecar(), "Rewritten sidecar is current again");
+
+    std::ofstream(dir / simulation::FrameIndex::SIDECAR_FILE_NAME, std::ios::binary | std::ios::trunc) << "garbage";
+    const auto recovered = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(!recovered.isFromSidecar() && recovered.size() == FRAME_COUNT + 1, "Damaged sidecar is rebuilt");
+}
+
+void testFindNearest()
+{
+    std::cout << "\n=== Testing nearest-timestamp lookup ===" << std::endl;
+
+    const fs::path dir = fs::temp_directory_path() / "adsil_frame_index_test";
+    const auto index = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+
+    SimpleTest::assert_true(index.findNearest(0.0) == 0, "Time before the recording clamps to the first frame");
+    SimpleTest::assert_true(index.findNearest(1e9) == static_cast<int>(index.size()) - 1, "Time after it clamps to the last");
+    SimpleTest::assert_true(index.findNearest(50.52) == 5, "Rounds down to the closer frame");
+    SimpleTest::assert_true(index.findNearest(50.58) == 6, "Rounds up to the closer frame");
+    SimpleTest::assert_true(simulation::FrameIndex().findNearest(1.0) == -1, "Empty index has no nearest frame");
+}
+
+void testCorruptFrameSkipped()
+{
+    std::cout << "\n=== Testing an unreadable frame is skipped ===" << std::endl;
+
+    const fs::path dir = fs::temp_directory_path() / "adsil_frame_index_test";
+    const auto total = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame).size();
+    std::ofstream(frameFile(dir, 2), std::ios::binary | std::ios::trunc) << "not a frame";
+
+    const auto index = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(index.size() == total - 1, "Every other frame is still indexed");
+    SimpleTest::assert_true(index.entry(2).frameId == 3, "The bad frame is left out");
+
+    const auto again = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(!again.isFromSidecar(), "The folder is re-indexed until the frame is readable");
+
+    simulation::FrameBinaryCodec::writeFile(makeFrame(2, 12), frameFile(dir, 2));
+    const auto repaired = simulation::FrameIndex::loadOrBuild(dir.string(), readFrame);
+    SimpleTest::assert_true(repaired.size() == total && repaired.entry(2).frameId == 2, "A repaired frame comes back");
+}
+
+void testFromPack()
+{
+    std::cout << "\n=== Testing an index taken from a frame pack ===" << std::endl;
+
+    const auto path = (fs::temp_directory_path() / "adsil_frame_index_test.adspack").string();
+    {
+        simulation::FramePackWriter writer(path);
+        for (int i = 0; i < FRAME_COUNT; ++i)
+            writer.append(makeFrame(i, 4 + i));
+        writer.finish();
+    }
+
+    const auto pack = simulation::FramePack::open(path);
+    const auto index = simulation::FrameIndex::fromPack(*pack);
+    SimpleTest::assert_true(index.size() == FRAME_COUNT, "One entry per packed frame");
+    SimpleTest::assert_true(index.entry(2).path == path && index.entry(2).offset == pack->entry(2).offset,
+                            "Entries point into the pack");
+    SimpleTest::assert_true(index.entry(2).pointCount == 6, "Point counts come from the frame headers");
+    SimpleTest::assert_true(index.findNearest(50.9) == 9, "Timestamps come from the pack index");
+
+    fs::remove(path);
+    fs::remove_all(fs::temp_directory_path() / "adsil_frame_index_test");
+}
+
+int main()
+{
+    std::cout << "Running FrameIndex Tests..." << std::endl;
+
+    testBuildWritesSidecar();
+    testSidecarReused();
+    testChangedFrameRebuilds();
+    testFindNearest();
+    testCorruptFrameSkipped();
+    testFromPack();
+
+    std::cout << "\n[SUCCESS] All FrameIndex tests passed!" << std::endl;
+    return 0;
+}
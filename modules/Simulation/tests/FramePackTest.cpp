@@ -0,0 +1,180 @@
+// Unit tests for the memory-mapped ADSPACK frame pack.
+
+#include <simulation/implementations/FramePack.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static const std::size_t FRAME_COUNT = 100;
+
+// Frame i has i % 7 + 1 points (odd sizes exercise the 16-byte padding) and timestamp 1000 + i/10
+static simulation::Frame makeFrame(std::size_t i)
+{
+    simulation::Frame frame;
+    frame.frameId = static_cast<int>(i);
+    frame.timestamp = 1000.0 + static_cast<double>(i) * 0.1;
+    frame.linearAcceleration = {0.0f, 0.0f, 9.81f};
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (std::size_t p = 0; p < i % 7 + 1; ++p)
+    {
+        const float t = static_cast<float>(i * 10 + p);
+        cloud->addPoint(math::Point(t, -t, t * 0.5f));
+    }
+    frame.cloud = cloud;
+    return frame;
+}
+
+static std::string writePack(const std::string &name)
+{
+    const auto path = (std::filesystem::temp_directory_path() / name).string();
+    simulation::FramePackWriter writer(path);
+    for (std::size_t i = 0; i < FRAME_COUNT; ++i)
+    {
+        writer.append(makeFrame(i));
+    }
+    writer.finish();
+    return path;
+}
+
+static bool openThrows(const std::string &path)
+{
+    try
+    {
+        (void)simulation::FramePack::open(path);
+    }
+    catch (const std::runtime_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+void testRandomAccess()
+{
+    std::cout << "\n=== testRandomAccess ===" << std::endl;
+    const auto path = writePack("adsil_frame_pack_test.adspack");
+    const auto pack = simulation::FramePack::open(path);
+    SimpleTest::assert_true(pack->frameCount() == FRAME_COUNT, "Index lists every appended frame");
+
+    bool allMatch = true;
+    for (std::size_t step = 0; step < FRAME_COUNT; ++step)
+    {
+        const std::size_t i = (step * 37) % FRAME_COUNT; // out-of-order access
+        const auto expected = makeFrame(i);
+        const auto loaded = pack->loadFrame(i);
+        allMatch = allMatch && pack->timestamp(i) == expected.timestamp && pack->frameId(i) == expected.frameId &&
+                   loaded->timestamp == expected.timestamp && loaded->cloud->size() == expected.cloud->size() &&
+                   loaded->cloud->getPoints().back().x() == expected.cloud->getPoints().back().x() &&
+                   loaded->linearAcceleration == expected.linearAcceleration;
+    }
+    SimpleTest::assert_true(allMatch, "Frames and timestamps match in random order");
+
+    bool outOfRange = false;
+    try
+    {
+        (void)pack->loadFrame(FRAME_COUNT);
+    }
+    catch (const std::out_of_range &)
+    {
+        outOfRange = true;
+    }
+    SimpleTest::assert_true(outOfRange, "Index past the end throws std::out_of_range");
+    std::filesystem::remove(path);
+}
+
+void testViewIsZeroCopy()
+{
+    std::cout << "\n=== testViewIsZeroCopy ===" << std::endl;
+    const auto path = writePack("adsil_frame_pack_view_test.adspack");
+    const auto pack = simulation::FramePack::open(path);
+
+    const auto first = pack->view(3);
+    const auto second = pack->view(3);
+    SimpleTest::assert_true(first.xyz.data() == second.xyz.data(), "Views of one frame share the mapped bytes");
+    SimpleTest::assert_true(first.pointCount == 4 && first.xyz.size() == 12, "View exposes 3 floats per point");
+    SimpleTest::assert_true(first.xyz[0] == 30.0f && first.xyz[1] == -30.0f, "View reads the points in place");
+    std::filesystem::remove(path);
+}
+
+void testRejectsDamagedPacks()
+{
+    std::cout << "\n=== testRejectsDamagedPacks ===" << std::endl;
+    const auto path = writePack("adsil_frame_pack_damaged_test.adspack");
+    std::vector<char> bytes;
+    {
+        std::ifstream file(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    auto rewrite = [&](const std::vector<char> &content)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    };
+
+    auto truncated = bytes;
+    truncated.resize(bytes.size() / 2);
+    rewrite(truncated);
+    SimpleTest::assert_true(openThrows(path), "Truncated pack is rejected");
+
+    auto badTrailer = bytes;
+    badTrailer[bytes.size() - simulation::FramePack::TRAILER_SIZE] ^= 0x40; // index offset
+    rewrite(badTrailer);
+    SimpleTest::assert_true(openThrows(path), "Corrupted index offset is rejected");
+
+    auto badEntry = bytes;
+    const std::size_t firstEntry = bytes.size() - simulation::FramePack::TRAILER_SIZE -
+                                   FRAME_COUNT * simulation::FramePack::INDEX_ENTRY_SIZE;
+    badEntry[firstEntry + 8 + 5] = 0x7f; // frame size far past the end of the file
+    rewrite(badEntry);
+    SimpleTest::assert_true(openThrows(path), "Out-of-range index entry is rejected");
+
+    auto badMagic = bytes;
+    badMagic[0] = '{';
+    rewrite(badMagic);
+    SimpleTest::assert_true(openThrows(path), "Wrong magic is rejected");
+
+    SimpleTest::assert_true(openThrows(path + ".missing"), "Missing file is rejected");
+    std::filesystem::remove(path);
+}
+
+int main()
+{
+    std::cout << "FramePack Test Suite" << std::endl;
+    std::cout << "====================" << std::endl;
+
+    testRandomAccess();
+    testViewIsZeroCopy();
+    testRejectsDamagedPacks();
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
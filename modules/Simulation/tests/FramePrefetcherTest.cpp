@@ -0,0 +1,272 @@
+// Unit tests for the direction-aware frame prefetcher, using an in-memory loader.
+
+#include <simulation/implementations/FramePrefetcher.hpp>
+#include <simulation/implementations/FrameCache.hpp>
+#include <simulation/implementations/Frame.hpp>
+#include <math/PointCloud.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+// Counts loads per frame index and optionally sleeps to mimic disk latency; also tracks how
+// many loads overlapped at most
+class FakeLoader
+{
+public:
+    FakeLoader(int frameCount, std::chrono::milliseconds delay) : loads_(static_cast<std::size_t>(frameCount)), delay_(delay) {}
+
+    std::shared_ptr<simulation::Frame> operator()(int index)
+    {
+        const int running = ++inFlight_;
+        int peak = peakInFlight_.load();
+        while (running > peak && !peakInFlight_.compare_exchange_weak(peak, running))
+        {
+        }
+        std::this_thread::sleep_for(delay_);
+        --inFlight_;
+        loads_[static_cast<std::size_t>(index)]++;
+        auto frame = std::make_shared<simulation::Frame>();
+        frame->frameId = index;
+        frame->cloud = std::make_shared<math::PointCloud>();
+        return frame;
+    }
+
+    int loads(int index) const { return loads_[static_cast<std::size_t>(index)].load(); }
+
+    int peakInFlight() const { return peakInFlight_.load(); }
+
+    int totalLoads() const
+    {
+        int total = 0;
+        for (const auto &count : loads_)
+            total += count.load();
+        return total;
+    }
+
+private:
+    std::vector<std::atomic<int>> loads_;
+    std::atomic<int> inFlight_{0};
+    std::atomic<int> peakInFlight_{0};
+    std::chrono::milliseconds delay_;
+};
+
+static bool waitUntil(const std::function<bool()> &condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+static simulation::FramePrefetcher::Loader wrap(FakeLoader &loader)
+{
+    return [&loader](int index)
+    { return loader(index); };
+}
+
+void testPrefetchFollowsDirection()
+{
+    std::cout << "\n=== testPrefetchFollowsDirection ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(100, std::chrono::milliseconds(0));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 100, 4, 1, 2);
+
+    prefetcher.request(50, +1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 5; }),
+                            "Forward request loads four ahead and one behind");
+    SimpleTest::assert_true(cache.contains(51) && cache.contains(54) && cache.contains(49) && !cache.contains(55),
+                            "Forward look-ahead covers 51..54 plus 49");
+
+    prefetcher.request(20, -1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 10; }),
+                            "Backward request loads five more frames");
+    SimpleTest::assert_true(cache.contains(19) && cache.contains(16) && cache.contains(21) && !cache.contains(15),
+                            "Backward look-ahead covers 16..19 plus 21");
+
+    prefetcher.request(98, +1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 12; }),
+                            "Request near the end stays inside the recording");
+    SimpleTest::assert_true(cache.contains(99) && cache.contains(97), "Only in-range frames requested");
+}
+
+void testCachedFramesAreNotReloaded()
+{
+    std::cout << "\n=== testCachedFramesAreNotReloaded ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(100, std::chrono::milliseconds(0));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 100, 4, 0, 2);
+
+    prefetcher.request(10, +1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 4; }),
+                            "First request loads 11..14");
+    prefetcher.request(11, +1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 5; }),
+                            "Next step only loads the new frame 15");
+    for (int i = 11; i <= 15; ++i)
+        SimpleTest::assert_true(loader.loads(i) == 1, "Frame " + std::to_string(i) + " read once");
+}
+
+void testSeekCancelsStaleRequests()
+{
+    std::cout << "\n=== testSeekCancelsStaleRequests ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(1000, std::chrono::milliseconds(20));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 1000, 16, 0, 1);
+
+    prefetcher.request(0, +1); // 16 slow loads queued on one thread
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    prefetcher.request(500, +1); // seek: 1..16 are no longer wanted
+
+    SimpleTest::assert_true(waitUntil([&]
+                                      { const auto stats = prefetcher.getStats();
+                                        return stats.queueDepth == 0 && stats.inFlight == 0; }),
+                            "Queue drains after the seek");
+    const auto stats = prefetcher.getStats();
+    SimpleTest::assert_true(stats.cancelled >= 14, "Stale requests were cancelled instead of read");
+    SimpleTest::assert_true(cache.contains(501) && cache.contains(516), "Seek target's look-ahead was loaded");
+    SimpleTest::assert_true(loader.totalLoads() <= 16 + 2, "At most the in-flight stale frames were read");
+}
+
+void testAcquireWaitsForInFlightLoad()
+{
+    std::cout << "\n=== testAcquireWaitsForInFlightLoad ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(100, std::chrono::milliseconds(50));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 100, 1, 0, 1);
+
+    prefetcher.request(10, +1); // frame 11 starts loading
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().inFlight == 1; }),
+                            "Frame 11 is in flight");
+
+    const auto frame = prefetcher.acquire(11);
+    SimpleTest::assert_true(frame && frame->frameId == 11, "acquire() returns the prefetched frame");
+    SimpleTest::assert_true(loader.loads(11) == 1, "In-flight frame is not read a second time");
+    SimpleTest::assert_true(prefetcher.getStats().stalls == 1, "Waiting for it counts as a stall");
+
+    const auto again = prefetcher.acquire(11);
+    SimpleTest::assert_true(again == frame && prefetcher.getStats().stalls == 1, "Cached frame is served without a stall");
+
+    (void)prefetcher.acquire(70);
+    SimpleTest::assert_true(prefetcher.getStats().stalls == 2 && loader.loads(70) == 1, "Uncached frame loads synchronously as a stall");
+}
+
+void testFailedLoadIsCounted()
+{
+    std::cout << "\n=== testFailedLoadIsCounted ===" << std::endl;
+    simulation::FrameCache cache;
+    simulation::FramePrefetcher prefetcher(cache, [](int) -> std::shared_ptr<simulation::Frame>
+                                           { throw std::runtime_error("disk on fire"); },
+                                           10, 2, 0, 1);
+    prefetcher.request(0, +1);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().failures == 2; }),
+                            "Loader exceptions are counted, not propagated");
+    SimpleTest::assert_true(prefetcher.hasFailed(1) && prefetcher.hasFailed(2), "Failed frames are recorded");
+    SimpleTest::assert_true(!prefetcher.hasFailed(0) && !prefetcher.hasFailed(3), "Frames never tried have not failed");
+}
+
+void testEvictedFrameHasNotFailed()
+{
+    std::cout << "\n=== testEvictedFrameHasNotFailed ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(10, std::chrono::milliseconds(0));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 10, 1, 0, 1);
+
+    prefetcher.request(4, +1, true);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 2; }),
+                            "Centre and look-ahead load");
+    cache.clear();
+    SimpleTest::assert_true(!cache.contains(4) && !prefetcher.isPending(4) && !prefetcher.hasFailed(4),
+                            "An evicted frame is neither pending nor failed");
+
+    prefetcher.request(4, +1, true);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return cache.contains(4); }),
+                            "Requesting it again reloads it");
+}
+
+void testWindowLoadsConcurrently()
+{
+    std::cout << "\n=== testWindowLoadsConcurrently ===" << std::endl;
+    simulation::FrameCache cache;
+    FakeLoader loader(100, std::chrono::milliseconds(40));
+    simulation::FramePrefetcher prefetcher(cache, wrap(loader), 100, 6, 1, 8);
+    SimpleTest::assert_true(prefetcher.getIoThreadCount() == 8, "Explicit thread count is used as given");
+
+    // Same order as FrameBufferManager: queue the neighbours, then read the centre here
+    prefetcher.request(50, +1);
+    (void)prefetcher.acquire(50);
+    SimpleTest::assert_true(waitUntil([&]
+                                      { return prefetcher.getStats().completed == 7; }),
+                            "Whole window is loaded");
+
+    // Each load sleeps 40 ms, so with eight threads they overlap rather than run one by one
+    SimpleTest::assert_true(loader.peakInFlight() > 1, "Window frames load in parallel");
+    SimpleTest::assert_true(loader.totalLoads() == 8, "Every frame of the window is read once");
+}
+
+void testAutoIoThreads()
+{
+    std::cout << "\n=== testAutoIoThreads ===" << std::endl;
+    using simulation::FramePrefetcher;
+    const auto threads = FramePrefetcher::resolveIoThreads(FramePrefetcher::AUTO_IO_THREADS, 8, 3);
+    SimpleTest::assert_true(threads >= 2 && threads <= FramePrefetcher::MAX_AUTO_IO_THREADS, "Auto picks 2..8 threads");
+    SimpleTest::assert_true(FramePrefetcher::resolveIoThreads(FramePrefetcher::AUTO_IO_THREADS, 1, 0) <= 2,
+                            "Auto never exceeds the frames of one request");
+    SimpleTest::assert_true(FramePrefetcher::resolveIoThreads(3, 8, 3) == 3, "Explicit count is kept");
+}
+
+int main()
+{
+    std::cout << "FramePrefetcher Test Suite" << std::endl;
+    std::cout << "==========================" << std::endl;
+
+    testPrefetchFollowsDirection();
+    testCachedFramesAreNotReloaded();
+    testSeekCancelsStaleRequests();
+    testAcquireWaitsForInFlightLoad();
+    testFailedLoadIsCounted();
+    testEvictedFrameHasNotFailed();
+    testWindowLoadsConcurrently();
+    testAutoIoThreads();
+
+    std::cout << "\n=== All Tests Passed ===" << std::endl;
+    return 0;
+}
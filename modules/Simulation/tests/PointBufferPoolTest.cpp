@@ -0,0 +1,146 @@
+// Tests for PointBufferPool: buffer reuse, best-fit selection, recycling through shared clouds
+// and the pool size limit.
+
+#include <simulation/implementations/PointBufferPool.hpp>
+#include <math/PointCloud.hpp>
+#include <math/Point.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Simple test framework
+class SimpleTest
+{
+public:
+    static void assert_true(bool condition, const std::string &message)
+    {
+        if (!condition)
+        {
+            std::cerr << "[FAIL] " << message << std::endl;
+            exit(1);
+        }
+        else
+        {
+            std::cout << "[PASS] " << message << std::endl;
+        }
+    }
+};
+
+static std::shared_ptr<const math::PointCloud> fillAndShare(simulation::PointBufferPool &pool, std::size_t count)
+{
+    auto points = pool.acquire(count);
+    for (std::size_t i = 0; i < count; ++i)
+        points.emplace_back(static_cast<float>(i), 0.0f, 0.0f);
+    return pool.share(math::PointCloud(std::move(points)));
+}
+
+void testSharedCloudReturnsStorage()
+{
+    std::cout << "\n=== Testing storage returns when the last holder drops the cloud ===" << std::endl;
+
+    auto pool = std::make_shared<simulation::PointBufferPool>();
+    auto cloud = fillAndShare(*pool, 1000);
+    const math::Point *storage = cloud->getPoints().data();
+    SimpleTest::assert_true(cloud->size() == 1000, "Shared cloud keeps its points");
+    SimpleTest::assert_true(pool->getStats().allocated == 1, "First acquire allocates");
+
+    auto observer = cloud;
+    cloud.reset();
+    SimpleTest::assert_true(pool->getStats().pooledBuffers == 0, "Storage stays while an observer holds the cloud");
+
+    observer.reset();
+    SimpleTest::assert_true(pool->getStats().pooledBuffers == 1, "Storage returns after the last holder");
+
+    const auto reused = pool->acquire(800);
+    SimpleTest::assert_true(reused.data() == storage && reused.empty(), "Next acquire gets the same storage, empty");
+    SimpleTest::assert_true(pool->getStats().reused == 1, "Reuse is counted");
+}
+
+void testBestFit()
+{
+    std::cout << "\n=== Testing the smallest fitting buffer is chosen ===" << std::endl;
+
+    simulation::PointBufferPool pool;
+    std::vector<math::Point> small, large;
+    small.reserve(100);
+    large.reserve(10000);
+    const math::Point *smallData = small.data();
+    const math::Point *largeData = large.data();
+    pool.recycle(std::move(large));
+    pool.recycle(std::move(small));
+
+    SimpleTest::assert_true(pool.acquire(50).data() == smallData, "Small request takes the small buffer");
+
+    pool.recycle(std::vector<math::Point>(1, math::Point(0.0f, 0.0f, 0.0f)));
+    SimpleTest::assert_true(pool.acquire(5000).data() == largeData, "Large request takes the large buffer");
+
+    const auto grown = pool.acquire(20000);
+    SimpleTest::assert_true(grown.capacity() >= 20000, "Too-small buffer is grown");
+    SimpleTest::assert_true(pool.getStats().grown == 1, "Growth is counted");
+}
+
+void testPoolLimit()
+{
+    std::cout << "\n=== Testing the pool keeps at most maxBuffers ===" << std::endl;
+
+    auto pool = std::make_shared<simulation::PointBufferPool>(2);
+    std::vector<std::shared_ptr<const math::PointCloud>> clouds;
+    for (int i = 0; i < 4; ++i)
+        clouds.push_back(fillAndShare(*pool, 10));
+    clouds.clear();
+
+    const auto stats = pool->getStats();
+    SimpleTest::assert_true(stats.pooledBuffers == 2, "Pool is capped");
+    SimpleTest::assert_true(stats.recycled == 2 && stats.dropped == 2, "Overflow is freed and counted");
+}
+
+void testCloudOutlivesPool()
+{
+    std::cout << "\n=== Testing a cloud may outlive its pool ===" << std::endl;
+
+    auto pool = std::make_shared<simulation::PointBufferPool>();
+    auto cloud = fillAndShare(*pool, 10);
+    pool.reset();
+    SimpleTest::assert_true(cloud->size() == 10, "Cloud is still usable");
+    cloud.reset();
+    SimpleTest::assert_true(true, "Destroying it after the pool is safe");
+}
+
+void testConcurrentUse()
+{
+    std::cout << "\n=== Testing concurrent acquire and release ===" << std::endl;
+
+    auto pool = std::make_shared<simulation::PointBufferPool>(4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool]
+                             {
+            for (int i = 0; i < 200; ++i)
+                fillAndShare(*pool, 100 + static_cast<std::size_t>(i % 7)); });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    const auto stats = pool->getStats();
+    SimpleTest::assert_true(stats.reused + stats.grown + stats.allocated == 800, "Every acquire is accounted for");
+    SimpleTest::assert_true(stats.allocated <= 4 + 4, "Steady state stops allocating");
+}
+
+int main()
+{
+    std::cout << "Running PointBufferPool Tests..." << std::endl;
+
+    testSharedCloudReturnsStorage();
+    testBestFit();
+    testPoolLimit();
+    testCloudOutlivesPool();
+    testConcurrentUse();
+
+    std::cout << "\n[SUCCESS] All PointBufferPool tests passed!" << std::endl;
+    return 0;
+}
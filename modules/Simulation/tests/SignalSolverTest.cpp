@@ -14,7 +14,9 @@
 #include <iostream>
 #include <cassert>
 #include <cstdlib>
+#include <cmath>
 #include <stdexcept>
+#include <thread>
 
 // Simple test framework
 class SimpleTest
@@ -207,8 +209,330 @@ static void test_deterministic_single_point_fixture()
     // Future enhancement: lock coordinates with tolerance once stabilized.
 }
 
+static void test_repeatedSolve_warmStartKeepsResult()
+{
+    std::cout << "\n=== test_repeatedSolve_warmStartKeepsResult ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {3.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 3.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, 0.0f, 3.0f}),
+        makeDevice("rx3", {2.0f, 2.0f, 2.0f})};
+    scene->setCar(buildCar(tx, rxs));
+
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (int i = 0; i < 200; ++i)
+    {
+        float t = static_cast<float>(i) * 0.05f;
+        cloud->addPoint({5.0f + t, 0.3f * t, -0.2f * t});
+    }
+    scene->setExternalPointCloud(cloud);
+
+    simulation::SignalSolver solver(scene);
+    auto first = solver.solve();
+    // Second solve is warm-started from the first one's winners and must agree exactly
+    auto second = solver.solve();
+
+    bool same = first->size() == second->size();
+    for (size_t i = 0; same && i < first->size(); ++i)
+    {
+        const auto &a = first->getPoints()[i];
+        const auto &b = second->getPoints()[i];
+        same = a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+    }
+    SimpleTest::assert_true(same, "Warm-started solve reproduces the cold solve");
+}
+
+static void test_parallelSolve_matchesSequential()
+{
+    std::cout << "\n=== test_parallelSolve_matchesSequential ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+
+    // Several transmitters so both pair solving and trilateration have work to spread
+    auto carNode = std::make_shared<spatial::TransformNode>();
+    SharedVec<Device> txs{
+        makeDevice("tx0", {0.0f, 0.0f, 0.0f}),
+        makeDevice("tx1", {0.0f, 0.5f, 0.0f}),
+        makeDevice("tx2", {0.0f, -0.5f, 0.2f}),
+        makeDevice("tx3", {0.5f, 0.0f, -0.2f})};
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {3.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 3.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, 0.0f, 3.0f}),
+        makeDevice("rx3", {2.0f, 2.0f, 2.0f})};
+    CarConfig cfg(carNode, txs, rxs, Car::DefaultCarDimension);
+    scene->setCar(std::make_shared<Car>(cfg));
+
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (int i = 0; i < 2000; ++i)
+    {
+        float t = static_cast<float>(i) * 0.01f;
+        cloud->addPoint({5.0f + t, std::sin(t) * 2.0f, std::cos(t * 0.7f)});
+    }
+    scene->setExternalPointCloud(cloud);
+
+    simulation::SignalSolver sequential(scene, 1);
+    simulation::SignalSolver parallel(scene, 4);
+    auto expected = sequential.solve();
+
+    // Repeat to exercise the persistent pool across solves
+    for (int run = 0; run < 3; ++run)
+    {
+        auto actual = parallel.solve();
+        bool same = expected->size() == actual->size();
+        for (size_t i = 0; same && i < expected->size(); ++i)
+        {
+            const auto &a = expected->getPoints()[i];
+            const auto &b = actual->getPoints()[i];
+            same = a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+        }
+        SimpleTest::assert_true(same, "Parallel solve run " + std::to_string(run) + " matches sequential output");
+    }
+}
+
+static bool samePoints(const math::PointCloud &a, const math::PointCloud &b)
+{
+    bool same = a.size() == b.size();
+    for (size_t i = 0; same && i < a.size(); ++i)
+    {
+        const auto &p = a.getPoints()[i];
+        const auto &q = b.getPoints()[i];
+        same = p.x() == q.x() && p.y() == q.y() && p.z() == q.z();
+    }
+    return same;
+}
+
+static void test_incrementalSolve_reusesUnchangedPairs()
+{
+    std::cout << "\n=== test_incrementalSolve_reusesUnchangedPairs ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {3.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 3.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, 0.0f, 3.0f}),
+        makeDevice("rx3", {2.0f, 2.0f, 2.0f})};
+    scene->setCar(buildCar(tx, rxs));
+
+    auto makeCloud = []
+    {
+        auto cloud = std::make_shared<math::PointCloud>();
+        for (int i = 0; i < 500; ++i)
+        {
+            float t = static_cast<float>(i) * 0.02f;
+            cloud->addPoint({5.0f + t, std::sin(t), 0.5f * std::cos(t)});
+        }
+        return cloud;
+    };
+    scene->setExternalPointCloud(makeCloud());
+
+    simulation::SignalSolver solver(scene);
+    auto first = solver.solve();
+    SimpleTest::assert_equal_int(4, static_cast<int>(solver.getLastPairStats().searchedPairs), "First solve searches every pair");
+
+    auto parked = solver.solve();
+    SimpleTest::assert_equal_int(4, static_cast<int>(solver.getLastPairStats().reusedPairs), "Unchanged scene reuses every pair");
+    SimpleTest::assert_true(samePoints(*first, *parked), "Reused pairs reproduce the previous result");
+
+    // A new frame with identical points (e.g. seeking back to the same frame) changes nothing
+    scene->setExternalPointCloud(makeCloud());
+    auto reloaded = solver.solve();
+    SimpleTest::assert_equal_int(4, static_cast<int>(solver.getLastPairStats().reusedPairs), "Identical new cloud reuses every pair");
+    SimpleTest::assert_true(samePoints(*first, *reloaded), "Identical new cloud reproduces the previous result");
+
+    // Moving one receiver only re-solves the pairs it belongs to
+    rxs[3]->getTransformNode()->setLocalTransform(spatial::Transform({2.0f, 2.5f, 2.0f}, {0.0f, 0.0f, 0.0f}));
+    auto moved = solver.solve();
+    SimpleTest::assert_equal_int(1, static_cast<int>(solver.getLastPairStats().searchedPairs), "Moving one receiver searches only its pair");
+
+    simulation::SignalSolver fresh(scene);
+    SimpleTest::assert_true(samePoints(*fresh.solve(), *moved), "Incremental solve matches a fresh solver after the move");
+
+    // A changed cloud inside the FOVs is noticed
+    auto shifted = makeCloud();
+    shifted->addPoint({4.0f, 0.1f, 0.1f});
+    scene->setExternalPointCloud(shifted);
+    auto changed = solver.solve();
+    SimpleTest::assert_equal_int(4, static_cast<int>(solver.getLastPairStats().searchedPairs), "New point in the FOVs searches every pair");
+    simulation::SignalSolver freshAfterChange(scene);
+    SimpleTest::assert_true(samePoints(*freshAfterChange.solve(), *changed), "Incremental solve matches a fresh solver after the cloud change");
+}
+
+static void test_multipleEchoes_detectHiddenObject()
+{
+    std::cout << "\n=== test_multipleEchoes_detectHiddenObject ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {0.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 1.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, -1.0f, 0.0f}),
+        makeDevice("rx3", {0.0f, 0.0f, 1.0f})};
+    scene->setCar(buildCar(tx, rxs));
+
+    // Two reflectors: the second one is farther away from every device
+    auto cloud = std::make_shared<math::PointCloud>();
+    cloud->addPoint({5.0f, 0.5f, 0.2f});
+    cloud->addPoint({9.0f, -1.0f, 0.5f});
+    scene->setExternalPointCloud(cloud);
+
+    simulation::SignalSolver single(scene);
+    auto closestOnly = single.solve();
+
+    simulation::SignalSolver multi(scene);
+    multi.setEchoCount(2);
+    auto withEchoes = multi.solve();
+
+    bool prefix = closestOnly->size() <= withEchoes->size();
+    for (size_t i = 0; prefix && i < closestOnly->size(); ++i)
+    {
+        const auto &a = closestOnly->getPoints()[i];
+        const auto &b = withEchoes->getPoints()[i];
+        prefix = a.x() == b.x() && a.y() == b.y() && a.z() == b.z();
+    }
+    SimpleTest::assert_true(prefix, "First-echo hypothesis gives the single-echo result first");
+
+    bool hiddenFound = false;
+    for (const auto &p : withEchoes->getPoints())
+    {
+        hiddenFound = hiddenFound || p.distanceTo(math::Point(9.0f, -1.0f, 0.5f)) < 0.05f;
+    }
+    SimpleTest::assert_true(hiddenFound, "Second echo reveals the farther reflector");
+    // Mixed-reflector combinations violate the baseline bound and are pruned
+    SimpleTest::assert_true(withEchoes->size() <= closestOnly->size() + 2, "Inconsistent echo combinations are pruned");
+
+    bool threw = false;
+    try
+    {
+        multi.setEchoCount(simulation::SignalSolver::MAX_ECHOES + 1);
+    }
+    catch (const std::invalid_argument &)
+    {
+        threw = true;
+    }
+    SimpleTest::assert_true(threw, "Echo count above MAX_ECHOES is rejected");
+}
+
+static void test_repeatedSolve_scratchStaysInArena()
+{
+    std::cout << "\n=== test_repeatedSolve_scratchStaysInArena ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {3.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 3.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, 0.0f, 3.0f}),
+        makeDevice("rx3", {2.0f, 2.0f, 2.0f})};
+    scene->setCar(buildCar(tx, rxs));
+
+    auto cloud = std::make_shared<math::PointCloud>();
+    for (int i = 0; i < 300; ++i)
+    {
+        float t = static_cast<float>(i) * 0.03f;
+        cloud->addPoint({5.0f + t, 0.2f * t, -0.1f * t});
+    }
+    scene->setExternalPointCloud(cloud);
+
+    simulation::SignalSolver solver(scene, 2);
+    for (int run = 0; run < 3; ++run)
+    {
+        (void)solver.solve();
+    }
+    const auto stats = solver.getLastArenaStats();
+    SimpleTest::assert_true(stats.allocations > 0, "Solver scratch is drawn from the arena");
+    SimpleTest::assert_equal_int(0, static_cast<int>(stats.overflowBuffers), "Steady-state solve needs no arena overflow");
+}
+
+static void test_collinearReceivers_skippedWithoutThrowing()
+{
+    std::cout << "\n=== test_collinearReceivers_skippedWithoutThrowing ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    // Receivers 1..3 on one line: no trilateration frame exists
+    SharedVec<Device> rxs{makeDevice("rx1", {0, 0.5F, 0}), makeDevice("rx2", {0, 1, 0}), makeDevice("rx3", {0, 2, 0}), makeDevice("rx4", {0, 3, 0})};
+    scene->setCar(buildCar(tx, rxs));
+    auto cloud = std::make_shared<math::PointCloud>();
+    cloud->addPoint({5, 0, 0});
+    scene->setExternalPointCloud(cloud);
+    auto solver = simulation::SignalSolver(scene);
+
+    bool threw = false;
+    std::shared_ptr<math::PointCloud> result;
+    try
+    {
+        result = solver.solve();
+        result = solver.solve(); // second solve reuses the cached receiver basis
+    }
+    catch (const std::exception &)
+    {
+        threw = true;
+    }
+    SimpleTest::assert_true(!threw, "Collinear receivers do not throw");
+    SimpleTest::assert_true(result && result->empty(), "Collinear receivers yield no ADSIL points");
+}
+
+static void test_prepare_solvesCapturedPoses()
+{
+    std::cout << "\n=== test_prepare_solvesCapturedPoses ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+    auto tx = makeDevice("tx", {0, 0, 0});
+    SharedVec<Device> rxs{
+        makeDevice("rx0", {3.0f, 0.0f, 0.0f}),
+        makeDevice("rx1", {0.0f, 3.0f, 0.0f}),
+        makeDevice("rx2", {0.0f, 0.0f, 3.0f}),
+        makeDevice("rx3", {2.0f, 2.0f, 2.0f})};
+    scene->setCar(buildCar(tx, rxs));
+    auto cloud = std::make_shared<math::PointCloud>();
+    cloud->addPoint({5.0f, 0.2f, 0.1f});
+    scene->setExternalPointCloud(cloud);
+
+    simulation::SignalSolver reference(scene);
+    auto expected = reference.solve();
+    SimpleTest::assert_true(!expected->empty(), "Reference pose detects the point");
+
+    // The scene thread captures the poses, then moves on before the solver thread runs
+    simulation::SignalSolver solver(scene, 2);
+    solver.prepare();
+    rxs[3]->getTransformNode()->setLocalTransform(spatial::Transform({2.0f, 2.5f, 2.0f}, {0.0f, 0.0f, 0.0f}));
+
+    std::shared_ptr<math::PointCloud> captured;
+    std::thread worker([&]
+                       { captured = solver.solve(); });
+    worker.join();
+    SimpleTest::assert_true(samePoints(*expected, *captured), "Prepared solve uses the poses captured by prepare()");
+
+    // Without a pending capture the solver reads the current poses
+    auto current = solver.solve();
+    simulation::SignalSolver fresh(scene);
+    SimpleTest::assert_true(samePoints(*fresh.solve(), *current), "Unprepared solve uses the current poses");
+    SimpleTest::assert_true(!samePoints(*expected, *current), "Moving the receiver changes the result");
+}
+
 // Extend main to run deterministic test last so its printed output is easy to capture.
 
+static void test_sceneSharesFrameCloudWithoutCopy()
+{
+    std::cout << "\n=== test_sceneSharesFrameCloudWithoutCopy ===" << std::endl;
+    auto scene = std::make_shared<SimulationScene>();
+
+    auto first = std::make_shared<math::PointCloud>(std::vector<math::Point>{{1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}});
+    scene->setExternalPointCloud(first);
+    SimpleTest::assert_true(scene->getExternalPointCloud() == first, "Scene holds the frame's cloud itself, not a copy");
+
+    // A reader (the solver thread) keeps its snapshot while the frame buffer moves on
+    auto snapshot = scene->getMergedPointCloud();
+    auto second = std::make_shared<math::PointCloud>(std::vector<math::Point>{{3.0f, 0.0f, 0.0f}});
+    scene->setExternalPointCloud(second);
+
+    SimpleTest::assert_true(snapshot == first && snapshot->size() == 2, "Snapshot is unchanged by the next frame");
+    SimpleTest::assert_equal_int(2, static_cast<int>(scene->getPointIndex(snapshot)->size()), "Index matches the snapshot");
+    SimpleTest::assert_equal_int(1, static_cast<int>(scene->getMergedPointIndex()->size()), "Scene index follows the new frame");
+
+    scene->setExternalPointCloud(nullptr);
+    SimpleTest::assert_true(scene->getExternalPointCloud() && scene->getExternalPointCloud()->empty(), "Null frame leaves an empty cloud");
+}
+
 int main()
 {
     std::cout << "SignalSolver Test Suite" << std::endl;
@@ -220,7 +544,15 @@ int main()
         test_noReceivers_returnsEmpty();
         test_lessThanFourReceivers_trilaterationException();
         test_fourReceivers_withPoint_noException();
+        test_repeatedSolve_warmStartKeepsResult();
+        test_parallelSolve_matchesSequential();
+        test_incrementalSolve_reusesUnchangedPairs();
+        test_multipleEchoes_detectHiddenObject();
+        test_repeatedSolve_scratchStaysInArena();
+        test_collinearReceivers_skippedWithoutThrowing();
+        test_prepare_solvesCapturedPoses();
         test_deterministic_single_point_fixture();
+        test_sceneSharesFrameCloudWithoutCopy();
 
         std::cout << "\n=== All Tests Passed ===" << std::endl;
         return 0;
@@ -2,6 +2,7 @@
 
 #include <core/Alias.hpp>
 #include <memory>
+#include <cstdint>
 #include <vector>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -32,6 +33,10 @@ namespace spatial
         // Get the global/world transform (computed by combining with parent)
         Transform getGlobalTransform() const;
 
+        // Incremented every time the cached global transform is recomputed. Dependents that
+        // cache pose-derived data (e.g. device frustums) compare it to detect pose changes.
+        std::uint64_t getGlobalVersion() const;
+
         // Parent management
         void setParent(const std::shared_ptr<TransformNode> &parent);
         std::shared_ptr<TransformNode> getParent() const;
@@ -47,6 +52,7 @@ namespace spatial
         // Note: mutable for lazy evaluation in const methods - not thread-safe
         mutable Transform cachedGlobalTransform_;
         mutable bool dirty_ = true;
+        mutable std::uint64_t globalVersion_ = 0;
 
         // Local transform relative to parent
         Transform localTransform_;
@@ -59,6 +65,9 @@ namespace spatial
 
         // Internal method to update global transform if dirty
         void updateGlobalTransform() const;
+
+        // Marks this node and all descendants dirty so grandchildren never keep a stale pose
+        void markSubtreeDirty();
     };
 
 } // namespace spatial
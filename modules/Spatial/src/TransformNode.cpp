@@ -13,12 +13,7 @@ namespace spatial
     void TransformNode::setLocalTransform(const Transform &transform)
     {
         localTransform_ = transform;
-        dirty_ = true;
-        // Mark all children dirty too
-        for (auto &child : children_) // NOLINT(readability-qualified-auto)
-        {
-            child->dirty_ = true;
-        }
+        markSubtreeDirty();
     }
 
     const Transform &TransformNode::getLocalTransform() const
@@ -35,6 +30,15 @@ namespace spatial
         return cachedGlobalTransform_;
     }
 
+    std::uint64_t TransformNode::getGlobalVersion() const
+    {
+        if (dirty_)
+        {
+            updateGlobalTransform();
+        }
+        return globalVersion_;
+    }
+
     void TransformNode::setParent(const std::shared_ptr<TransformNode> &parent)
     {
         // Remove from old parent's children if exists
@@ -51,7 +55,7 @@ namespace spatial
             parent->children_.push_back(shared_from_this());
         }
 
-        dirty_ = true;
+        markSubtreeDirty();
     }
 
     std::shared_ptr<TransformNode> TransformNode::getParent() const
@@ -76,7 +80,7 @@ namespace spatial
             {
                 children_.erase(it, children_.end());
                 child->parent_.reset();
-                child->dirty_ = true;
+                child->markSubtreeDirty();
             }
         }
     }
@@ -97,6 +101,7 @@ namespace spatial
             cachedGlobalTransform_ = localTransform_;
         }
         dirty_ = false;
+        ++globalVersion_;
 
         // Propagate dirty flag to children
         for (auto &child : children_) // NOLINT(readability-qualified-auto)
@@ -105,4 +110,13 @@ namespace spatial
         }
     }
 
+    void TransformNode::markSubtreeDirty()
+    {
+        dirty_ = true;
+        for (auto &child : children_) // NOLINT(readability-qualified-auto)
+        {
+            child->markSubtreeDirty();
+        }
+    }
+
 } // namespace spatial
@@ -3,6 +3,7 @@
 #include <math/Point.hpp>
 #include <math/Vector.hpp>
 #include <cassert>
+#include <cmath>
 #include <iostream>
 
 using namespace spatial;
@@ -167,6 +168,28 @@ void test_TransformNode_modifications()
     std::cout << "✅ TransformNode modifications test passed" << std::endl;
 }
 
+void test_TransformNode_pose_version()
+{
+    std::cout << "Testing TransformNode pose version and grandchild invalidation..." << std::endl;
+
+    auto root = std::make_shared<TransformNode>(Transform(Point(0.0f, 0.0f, 0.0f), Vector(0.0f, 0.0f, 0.0f)));
+    auto child = std::make_shared<TransformNode>(Transform(Point(1.0f, 0.0f, 0.0f), Vector(0.0f, 0.0f, 0.0f)));
+    auto grandchild = std::make_shared<TransformNode>(Transform(Point(1.0f, 0.0f, 0.0f), Vector(0.0f, 0.0f, 0.0f)));
+    root->addChild(child);
+    child->addChild(grandchild);
+
+    assert(std::abs(grandchild->getGlobalTransform().getPosition().x() - 2.0f) < 1e-5f);
+    auto version = grandchild->getGlobalVersion();
+    assert(grandchild->getGlobalVersion() == version); // no pose change, no bump
+
+    // Moving the root must reach the grandchild even though it is two levels down
+    root->setLocalTransform(Transform(Point(0.0f, 5.0f, 0.0f), Vector(0.0f, 0.0f, 0.0f)));
+    assert(grandchild->getGlobalVersion() != version);
+    assert(std::abs(grandchild->getGlobalTransform().getPosition().y() - 5.0f) < 1e-5f);
+
+    std::cout << "✅ TransformNode pose version test passed" << std::endl;
+}
+
 int main()
 {
     std::cout << "🧪 Running Spatial Module Tests..." << std::endl;
@@ -178,6 +201,7 @@ int main()
         test_TransformNode_hierarchy();
         test_TransformNode_global_transform();
         test_TransformNode_modifications();
+        test_TransformNode_pose_version();
 
         std::cout << "✅ All Spatial module tests passed!" << std::endl;
         return 0;
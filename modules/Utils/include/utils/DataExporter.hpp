@@ -1,21 +1,63 @@
 #pragma once
 
+#include <core/MpscQueue.hpp>
+#include <utils/DetectionFile.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <fstream>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 namespace utils
 {
     /**
-     * @brief Exports simulation data to CSV files for post-processing.
+     * @brief Exports simulation data to CSV or binary files for post-processing.
      *
-     * Thread-safe singleton-style exporter that writes detected ADSIL points
-     * to a CSV file with columns: frame, timestamp, transmitter, x, y, z
+     * Singleton-style exporter that writes detected ADSIL points with columns:
+     * frame, timestamp, transmitter, x, y, z. Format::Csv writes them as text,
+     * Format::Binary as an .adsdet file (see DetectionFileFormat), which is several times
+     * smaller and needs no text formatting; DetectionFileReader turns it back into CSV.
+     *
+     * exportPoint() only copies a fixed-size record into a lock-free queue; a writer thread
+     * started by startSession() formats the records and writes them in batches, flushing when
+     * FLUSH_INTERVAL has passed or FLUSH_BYTES have been written since the last flush. The
+     * writer sleeps for up to FLUSH_INTERVAL and is woken early once WAKE_RECORDS records (or a
+     * quarter of a smaller queue) are waiting. If the queue is full the record is dropped and
+     * counted rather than stalling the solver; after a failed write the rest of the session is
+     * counted as failed. endSession() writes out everything that was queued before it returns.
      */
     class DataExporter
     {
     public:
+        enum class Format
+        {
+            Csv,
+            Binary
+        };
+
+        static constexpr std::size_t DEFAULT_QUEUE_CAPACITY = 65536;
+        static constexpr std::size_t MAX_TRANSMITTER_NAME = 31; // longer names are truncated
+        static constexpr std::chrono::milliseconds FLUSH_INTERVAL{250};
+        static constexpr std::size_t FLUSH_BYTES = 1024 * 1024;
+        static constexpr std::size_t WAKE_RECORDS = 1024;
+
+        struct Stats
+        {
+            std::uint64_t enqueued = 0;   // records accepted by exportPoint() this session
+            std::uint64_t written = 0;    // rows written by the writer thread
+            std::uint64_t dropped = 0;    // records lost to a full queue
+            std::uint64_t failed = 0;     // records lost to a failed write
+            std::size_t queueDepth = 0;   // records waiting for the writer (approximate)
+            std::uint64_t batches = 0;    // writes issued to the file
+            std::uint64_t flushes = 0;    // flushes issued to the file
+        };
+
         static DataExporter &getInstance();
 
         // Disable copy/move
@@ -26,10 +68,18 @@ namespace utils
 
         /**
          * @brief Initialize the exporter with output directory path.
-         * @param outputDir Directory where CSV files will be written.
+         * @param outputDir Directory where export files will be written.
+         * @param queueCapacity Records the queue holds before exportPoint() starts dropping;
+         *        takes effect at the next startSession().
          * @return true if initialization succeeded, false otherwise.
          */
-        bool init(const std::string &outputDir);
+        bool init(const std::string &outputDir, std::size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+        /**
+         * @brief Select the file format; takes effect at the next startSession().
+         */
+        void setFormat(Format format);
+        Format getFormat() const;
 
         /**
          * @brief Start a new export session (creates new file with timestamp).
@@ -39,6 +89,9 @@ namespace utils
 
         /**
          * @brief Set the current frame context for subsequent point exports.
+         *
+         * Meant to be called from one thread (the simulation loop); exportPoint() may run
+         * concurrently on others and always sees a matching index/timestamp pair.
          * @param frameIndex Current frame number.
          * @param timestamp Current simulation timestamp.
          */
@@ -46,6 +99,9 @@ namespace utils
 
         /**
          * @brief Export a detected point for the current frame.
+         *
+         * Safe to call from any thread and never blocks on file I/O. Lock-free except for the
+         * call that wakes the writer, which briefly takes the wake-up mutex.
          * @param transmitterName Name of the transmitter that detected the point.
          * @param x X coordinate.
          * @param y Y coordinate.
@@ -54,37 +110,82 @@ namespace utils
         void exportPoint(const std::string &transmitterName, float x, float y, float z);
 
         /**
-         * @brief Finalize and close the export file.
+         * @brief Write out every queued record, then finalize and close the export file.
          */
         void endSession();
 
         /**
          * @brief Check if exporter is currently active.
          */
-        bool isActive() const { return isActive_; }
+        bool isActive() const { return isActive_.load(std::memory_order_acquire); }
 
         /**
          * @brief Get the path to the current export file.
          */
-        std::string getCurrentFilePath() const { return currentFilePath_; }
+        std::string getCurrentFilePath() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return currentFilePath_;
+        }
+
+        /**
+         * @brief Counters of the current (or last) session.
+         */
+        Stats getStats() const;
 
     private:
+        // One queued row; fixed size so enqueueing never allocates
+        struct Record
+        {
+            std::int32_t frame = 0;
+            float x = 0.0f;
+            float y = 0.0f;
+            float z = 0.0f;
+            double timestamp = 0.0;
+            char transmitter[MAX_TRANSMITTER_NAME + 1] = {};
+        };
+
         DataExporter() = default;
         ~DataExporter();
 
         std::string generateFileName() const;
+        void stopWriter();
+        void writerLoop();
 
+        // Session state; guarded by mutex_ (the writer thread owns the files while it runs)
+        Format format_ = Format::Csv;
+        Format sessionFormat_ = Format::Csv;
         std::ofstream file_;
+        std::unique_ptr<DetectionFileWriter> binaryFile_;
         std::string outputDir_;
         std::string currentFilePath_;
-        bool isActive_ = false;
         bool isInitialized_ = false;
-
-        // Current frame context
-        int currentFrameIndex_ = 0;
-        double currentTimestamp_ = 0.0;
-
+        std::size_t queueCapacity_ = DEFAULT_QUEUE_CAPACITY;
+        std::unique_ptr<core::MpscQueue<Record>> queue_;
+        std::thread writer_;
         mutable std::mutex mutex_;
+
+        std::atomic<bool> isActive_{false};
+        std::atomic<int> activeProducers_{0}; // exportPoint() calls between the active check and the push
+
+        // Writer wake-up
+        std::mutex wakeMutex_;
+        std::condition_variable wake_;
+        bool stopRequested_ = false;
+        std::atomic<bool> wakeRequested_{false}; // set by the producer that crossed wakeThreshold_
+        std::size_t wakeThreshold_ = WAKE_RECORDS;
+
+        // Current frame context, published with a sequence lock so readers never see a torn pair
+        std::atomic<std::uint32_t> contextSequence_{0};
+        std::atomic<std::int32_t> currentFrameIndex_{0};
+        std::atomic<double> currentTimestamp_{0.0};
+
+        std::atomic<std::uint64_t> enqueued_{0};
+        std::atomic<std::uint64_t> written_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint64_t> failed_{0};
+        std::atomic<std::uint64_t> batches_{0};
+        std::atomic<std::uint64_t> flushes_{0};
     };
 
 } // namespace utils
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <utils/MappedFile.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils
+{
+    /**
+     * @brief One detected point as stored in a detection export
+     */
+    struct Detection
+    {
+        std::int32_t frame = 0;
+        double timestamp = 0.0;
+        std::string_view transmitter;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
+    /**
+     * @brief Binary detection export (".adsdet" files) written by DataExporter
+     *
+     * Layout, all fields little-endian:
+     *
+     *   header (HEADER_SIZE bytes)
+     *        0     8  magic "ADSDET\0\0"
+     *        8     2  format version (VERSION)
+     *       10     2  header size in bytes
+     *       12     2  record size in bytes (RECORD_SIZE)
+     *       14     2  reserved, 0
+     *   records, RECORD_SIZE bytes each, in export order
+     *        0     4  frame (int32)
+     *        4     2  transmitter id (uint16, index into the name table)
+     *        6     2  reserved, 0
+     *        8    12  x, y, z (float32)
+     *   footer
+     *                 name table: uint32 count, then per name uint16 length + bytes
+     *                 frame index: uint64 count, then per run of records sharing a frame:
+     *                   int32 frame, uint32 reserved, float64 timestamp,
+     *                   uint64 first record, uint64 record count (FRAME_RUN_SIZE bytes)
+     *   trailer (TRAILER_SIZE bytes, end of file)
+     *        0     8  footer offset (uint64)
+     *        8     8  magic "ADSDEND\0"
+     *
+     * The timestamp is stored once per frame run rather than per record. The trailer is only
+     * written by finish(), so a file cut short by a crash is rejected instead of misread.
+     */
+    struct DetectionFileFormat
+    {
+        static constexpr char MAGIC[8] = {'A', 'D', 'S', 'D', 'E', 'T', '\0', '\0'};
+        static constexpr char END_MAGIC[8] = {'A', 'D', 'S', 'D', 'E', 'N', 'D', '\0'};
+        static constexpr std::uint16_t VERSION = 1;
+        static constexpr std::size_t HEADER_SIZE = 16;
+        static constexpr std::size_t RECORD_SIZE = 20;
+        static constexpr std::size_t FRAME_RUN_SIZE = 32;
+        static constexpr std::size_t TRAILER_SIZE = 16;
+        static constexpr const char *EXTENSION = ".adsdet";
+
+        // The CSV row DataExporter writes: frame,timestamp,transmitter,x,y,z with six decimals
+        static constexpr const char *CSV_HEADER = "frame,timestamp,transmitter,x,y,z\n";
+        static void appendCsvRow(std::string &out, const Detection &detection);
+    };
+
+    /**
+     * @class DetectionFileWriter
+     * @brief Streams detections into an .adsdet file
+     *
+     * append() only encodes into a memory buffer; writePending() hands that buffer to the file,
+     * so the caller decides the batch size. finish() writes the footer and closes the file.
+     *
+     * @note Thread Safety: Not thread-safe; DataExporter calls it from its writer thread only.
+     */
+    class DetectionFileWriter
+    {
+    public:
+        // Throws std::runtime_error if the file cannot be created
+        explicit DetectionFileWriter(const std::string &path);
+        ~DetectionFileWriter();
+
+        DetectionFileWriter(const DetectionFileWriter &) = delete;
+        DetectionFileWriter &operator=(const DetectionFileWriter &) = delete;
+
+        void append(std::int32_t frame, double timestamp, std::string_view transmitter, float x, float y, float z);
+
+        std::size_t pendingBytes() const { return pending_.size(); }
+        void writePending();
+        void flush();
+
+        // Writes pending records, the footer and the trailer; further appends are ignored
+        void finish();
+
+        std::uint64_t recordCount() const { return records_; }
+
+    private:
+        struct FrameRun
+        {
+            std::int32_t frame;
+            double timestamp;
+            std::uint64_t first;
+            std::uint64_t count;
+        };
+
+        std::uint16_t transmitterId(std::string_view name);
+
+        std::ofstream file_;
+        std::string path_;
+        std::vector<std::uint8_t> pending_;
+        std::vector<std::string> transmitters_;
+        std::size_t lastTransmitter_ = 0;
+        std::vector<FrameRun> runs_;
+        std::uint64_t records_ = 0;
+        bool finished_ = false;
+    };
+
+    /**
+     * @class DetectionFileReader
+     * @brief Memory-mapped reader for .adsdet files
+     *
+     * The header, footer and trailer are validated when the file is opened; records are
+     * decoded on demand straight from the mapping.
+     *
+     * @note Thread Safety: Immutable after construction, concurrent reads are safe.
+     */
+    class DetectionFileReader
+    {
+    public:
+        struct FrameRun
+        {
+            std::int32_t frame = 0;
+            double timestamp = 0.0;
+            std::uint64_t firstRecord = 0;
+            std::uint64_t recordCount = 0;
+        };
+
+        // Throws std::runtime_error on I/O errors, foreign files or unfinished files
+        explicit DetectionFileReader(const std::string &path);
+
+        std::uint64_t recordCount() const { return recordCount_; }
+        const std::vector<std::string> &transmitters() const { return transmitters_; }
+        const std::vector<FrameRun> &frameRuns() const { return runs_; }
+
+        // Visits detections with firstFrame <= frame <= lastFrame in file order
+        void forEach(const std::function<void(const Detection &)> &visit,
+                     std::int32_t firstFrame = std::numeric_limits<std::int32_t>::min(),
+                     std::int32_t lastFrame = std::numeric_limits<std::int32_t>::max()) const;
+
+        // Same text DataExporter writes in CSV mode, header included; returns the row count
+        std::uint64_t writeCsv(std::ostream &out,
+                               std::int32_t firstFrame = std::numeric_limits<std::int32_t>::min(),
+                               std::int32_t lastFrame = std::numeric_limits<std::int32_t>::max()) const;
+
+    private:
+        MappedFile file_;
+        std::uint64_t recordCount_ = 0;
+        std::vector<std::string> transmitters_;
+        std::vector<FrameRun> runs_;
+    };
+
+} // namespace utils
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace utils
+{
+    /**
+     * @brief Read-only memory mapping of a whole file.
+     *
+     * On POSIX systems the file is mapped with mmap, so its pages come from (and stay in) the
+     * shared page cache and are only read when touched. Elsewhere the file is read into memory
+     * once. The mapping lives as long as the object; it is move-only.
+     *
+     * @note Thread Safety: The mapped bytes are immutable, concurrent reads are safe.
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        // Throws std::runtime_error if the file cannot be opened or mapped
+        explicit MappedFile(const std::string &path);
+        ~MappedFile();
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        const std::uint8_t *data() const { return data_; }
+        std::size_t size() const { return size_; }
+        const std::string &getPath() const { return path_; }
+
+        // True when the bytes are an actual mapping rather than a heap copy
+        bool isMapped() const { return mapped_; }
+
+    private:
+        void release();
+
+        std::string path_;
+        const std::uint8_t *data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+    };
+}
@@ -1,12 +1,20 @@
 #include "utils/DataExporter.hpp"
 #include <iostream>
 #include <iomanip>
-#include <chrono>
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <filesystem>
+#include <stdexcept>
 
 namespace utils
 {
+    namespace
+    {
+        // Encoded rows are collected up to this size before one write() to the file
+        constexpr std::size_t WRITE_CHUNK_BYTES = 64 * 1024;
+    } // namespace
+
     DataExporter &DataExporter::getInstance()
     {
         static DataExporter instance;
@@ -18,11 +26,12 @@ namespace utils
         endSession();
     }
 
-    bool DataExporter::init(const std::string &outputDir)
+    bool DataExporter::init(const std::string &outputDir, std::size_t queueCapacity)
     {
         std::lock_guard<std::mutex> lock(mutex_);
 
         outputDir_ = outputDir;
+        queueCapacity_ = std::max<std::size_t>(queueCapacity, 1);
 
         // Ensure output directory exists
         try
@@ -50,13 +59,28 @@ namespace utils
         std::ostringstream oss;
         oss << "detected_points_"
             << std::put_time(&tm, "%Y-%m-%d_%H-%M-%S")
-            << ".csv";
+            << (format_ == Format::Binary ? DetectionFileFormat::EXTENSION : ".csv");
 
         return oss.str();
     }
 
+    void DataExporter::setFormat(Format format)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        format_ = format;
+    }
+
+    DataExporter::Format DataExporter::getFormat() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return format_;
+    }
+
     bool DataExporter::startSession()
     {
+        // Close existing session; its queued rows still go to its own file
+        endSession();
+
         std::lock_guard<std::mutex> lock(mutex_);
 
         if (!isInitialized_)
@@ -65,28 +89,60 @@ namespace utils
             return false;
         }
 
-        if (isActive_)
+        currentFilePath_ = outputDir_ + "/" + generateFileName();
+        sessionFormat_ = format_;
+
+        if (sessionFormat_ == Format::Binary)
         {
-            // Close existing session
-            file_.close();
+            try
+            {
+                binaryFile_ = std::make_unique<DetectionFileWriter>(currentFilePath_);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "[DataExporter] Failed to open file: " << e.what() << std::endl;
+                return false;
+            }
         }
+        else
+        {
+            file_.open(currentFilePath_, std::ios::out | std::ios::trunc);
+            if (!file_.is_open())
+            {
+                std::cerr << "[DataExporter] Failed to open file: " << currentFilePath_ << std::endl;
+                return false;
+            }
 
-        currentFilePath_ = outputDir_ + "/" + generateFileName();
+            // Write CSV header
+            file_ << DetectionFileFormat::CSV_HEADER;
+            file_.flush();
+            if (!file_)
+            {
+                std::cerr << "[DataExporter] Failed to write file: " << currentFilePath_ << std::endl;
+                file_.close();
+                return false;
+            }
+        }
 
-        file_.open(currentFilePath_, std::ios::out | std::ios::trunc);
-        if (!file_.is_open())
+        setFrameContext(0, 0.0);
+        enqueued_.store(0);
+        written_.store(0);
+        dropped_.store(0);
+        failed_.store(0);
+        batches_.store(0);
+        flushes_.store(0);
+
+        queue_ = std::make_unique<core::MpscQueue<Record>>(queueCapacity_);
+        wakeThreshold_ = std::clamp<std::size_t>(queue_->capacity() / 4, 1, WAKE_RECORDS);
         {
-            std::cerr << "[DataExporter] Failed to open file: " << currentFilePath_ << std::endl;
-            return false;
+            std::lock_guard<std::mutex> wakeLock(wakeMutex_);
+            stopRequested_ = false;
         }
+        wakeRequested_.store(false);
+        writer_ = std::thread(&DataExporter::writerLoop, this);
 
-        // Write CSV header
-        file_ << "frame,timestamp,transmitter,x,y,z\n";
-        file_.flush();
-
-        isActive_ = true;
-        currentFrameIndex_ = 0;
-        currentTimestamp_ = 0.0;
+        // Producers only touch queue_ after seeing this
+        isActive_.store(true, std::memory_order_release);
 
         std::cout << "[DataExporter] Started export session: " << currentFilePath_ << std::endl;
         return true;
@@ -94,43 +150,248 @@ namespace utils
 
     void DataExporter::setFrameContext(int frameIndex, double timestamp)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        currentFrameIndex_ = frameIndex;
-        currentTimestamp_ = timestamp;
+        // Odd sequence = update in progress; single writer, so no compare-and-swap needed.
+        // Release stores on the fields: a reader that sees a new field also sees the odd sequence
+        const auto sequence = contextSequence_.load(std::memory_order_relaxed);
+        contextSequence_.store(sequence + 1, std::memory_order_relaxed);
+        currentFrameIndex_.store(frameIndex, std::memory_order_release);
+        currentTimestamp_.store(timestamp, std::memory_order_release);
+        contextSequence_.store(sequence + 2, std::memory_order_release);
     }
 
     void DataExporter::exportPoint(const std::string &transmitterName, float x, float y, float z)
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-
-        if (!isActive_ || !file_.is_open())
+        // Announce the producer before checking isActive_: endSession() clears the flag and
+        // then waits for this count to reach zero, so no push can land after the final drain
+        activeProducers_.fetch_add(1);
+        if (!isActive_.load())
         {
+            activeProducers_.fetch_sub(1);
             return;
         }
 
-        // Write CSV row: frame,timestamp,transmitter,x,y,z
-        file_ << currentFrameIndex_ << ","
-              << std::fixed << std::setprecision(6) << currentTimestamp_ << ","
-              << transmitterName << ","
-              << std::fixed << std::setprecision(6) << x << ","
-              << std::fixed << std::setprecision(6) << y << ","
-              << std::fixed << std::setprecision(6) << z << "\n";
+        Record record;
+        std::uint32_t before = 0;
+        std::uint32_t after = 0;
+        do
+        {
+            before = contextSequence_.load(std::memory_order_acquire);
+            record.frame = currentFrameIndex_.load(std::memory_order_acquire);
+            record.timestamp = currentTimestamp_.load(std::memory_order_acquire);
+            after = contextSequence_.load(std::memory_order_relaxed);
+        } while ((before & 1U) != 0 || before != after);
+
+        record.x = x;
+        record.y = y;
+        record.z = z;
+        const auto length = std::min(transmitterName.size(), MAX_TRANSMITTER_NAME);
+        std::memcpy(record.transmitter, transmitterName.data(), length);
+        record.transmitter[length] = '\0';
 
-        // Flush periodically for reliability (every point for now, could optimize)
-        file_.flush();
+        if (queue_->tryPush(record))
+        {
+            enqueued_.fetch_add(1, std::memory_order_relaxed);
+
+            // One producer per writer cycle wakes it; taking the mutex before notifying means
+            // the writer is either still before its predicate check or already waiting
+            if (queue_->sizeApprox() >= wakeThreshold_ && !wakeRequested_.load(std::memory_order_relaxed) &&
+                !wakeRequested_.exchange(true))
+            {
+                {
+                    std::lock_guard<std::mutex> lock(wakeMutex_);
+                }
+                wake_.notify_one();
+            }
+        }
+        else
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+        activeProducers_.fetch_sub(1);
+    }
+
+    void DataExporter::writerLoop()
+    {
+        const bool binary = sessionFormat_ == Format::Binary;
+        std::string batch; // CSV text; the binary writer buffers its own records
+        batch.reserve(WRITE_CHUNK_BYTES + 256);
+        std::uint64_t batchRows = 0;
+        std::size_t bytesSinceFlush = 0;
+        auto lastFlush = std::chrono::steady_clock::now();
+        bool writeFailed = false;
+
+        const auto pendingBytes = [&]
+        {
+            return binary ? binaryFile_->pendingBytes() : batch.size();
+        };
+
+        const auto writeBatch = [&]
+        {
+            bytesSinceFlush += pendingBytes();
+            if (binary)
+            {
+                binaryFile_->writePending();
+            }
+            else
+            {
+                file_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                batch.clear();
+                if (!file_)
+                {
+                    throw std::runtime_error("could not write to the CSV file");
+                }
+            }
+            written_.fetch_add(batchRows, std::memory_order_relaxed);
+            batches_.fetch_add(1, std::memory_order_relaxed);
+            batchRows = 0;
+        };
+
+        bool stopping = false;
+        while (!stopping)
+        {
+            {
+                // Rows trickling in are picked up at the flush interval; bursts wake the writer earlier
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                wake_.wait_for(lock, FLUSH_INTERVAL, [this]
+                               { return stopRequested_ || wakeRequested_.load(); });
+                stopping = stopRequested_;
+                wakeRequested_.store(false);
+            }
+
+            // After a stop request every producer has finished, so this drains the queue completely
+            Record record;
+            try
+            {
+                while (queue_->tryPop(record))
+                {
+                    if (writeFailed)
+                    {
+                        failed_.fetch_add(1, std::memory_order_relaxed);
+                        continue;
+                    }
+                    if (binary)
+                    {
+                        binaryFile_->append(record.frame, record.timestamp, record.transmitter, record.x, record.y, record.z);
+                    }
+                    else
+                    {
+                        DetectionFileFormat::appendCsvRow(batch, {record.frame, record.timestamp, record.transmitter,
+                                                                  record.x, record.y, record.z});
+                    }
+                    ++batchRows;
+                    if (pendingBytes() >= WRITE_CHUNK_BYTES)
+                    {
+                        writeBatch();
+                    }
+                }
+                if (batchRows > 0)
+                {
+                    writeBatch();
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                if (!writeFailed && bytesSinceFlush > 0 && (stopping || bytesSinceFlush >= FLUSH_BYTES || now - lastFlush >= FLUSH_INTERVAL))
+                {
+                    if (binary)
+                    {
+                        binaryFile_->flush();
+                    }
+                    else
+                    {
+                        file_.flush();
+                        if (!file_)
+                        {
+                            throw std::runtime_error("could not flush the CSV file");
+                        }
+                    }
+                    flushes_.fetch_add(1, std::memory_order_relaxed);
+                    bytesSinceFlush = 0;
+                    lastFlush = now;
+                }
+            }
+            catch (const std::exception &e)
+            {
+                // Keep draining so producers never back up; the rest of the session is dropped
+                std::cerr << "[DataExporter] Export write failed: " << e.what() << std::endl;
+                failed_.fetch_add(batchRows, std::memory_order_relaxed);
+                batch.clear();
+                batchRows = 0;
+                writeFailed = true;
+            }
+        }
+    }
+
+    void DataExporter::stopWriter()
+    {
+        if (!writer_.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            stopRequested_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
     }
 
     void DataExporter::endSession()
     {
         std::lock_guard<std::mutex> lock(mutex_);
 
-        if (isActive_ && file_.is_open())
+        const bool wasActive = isActive_.exchange(false);
+        while (activeProducers_.load() != 0)
+        {
+            std::this_thread::yield(); // a producer is between its check and its push
+        }
+        stopWriter();
+
+        if (binaryFile_)
+        {
+            try
+            {
+                binaryFile_->finish();
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "[DataExporter] Failed to finish export file: " << e.what() << std::endl;
+            }
+            binaryFile_.reset();
+        }
+        if (file_.is_open())
         {
             file_.close();
-            std::cout << "[DataExporter] Export session ended: " << currentFilePath_ << std::endl;
         }
 
-        isActive_ = false;
+        if (wasActive)
+        {
+            std::cout << "[DataExporter] Export session ended: " << currentFilePath_
+                      << " (" << written_.load() << " rows";
+            if (dropped_.load() > 0)
+            {
+                std::cout << ", " << dropped_.load() << " dropped: queue full";
+            }
+            if (failed_.load() > 0)
+            {
+                std::cout << ", " << failed_.load() << " lost: write error";
+            }
+            std::cout << ")" << std::endl;
+        }
+    }
+
+    DataExporter::Stats DataExporter::getStats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        Stats stats;
+        stats.enqueued = enqueued_.load(std::memory_order_relaxed);
+        stats.written = written_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_.load(std::memory_order_relaxed);
+        stats.failed = failed_.load(std::memory_order_relaxed);
+        stats.queueDepth = queue_ ? queue_->sizeApprox() : 0;
+        stats.batches = batches_.load(std::memory_order_relaxed);
+        stats.flushes = flushes_.load(std::memory_order_relaxed);
+        return stats;
     }
 
 } // namespace utils
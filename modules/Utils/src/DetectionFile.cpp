@@ -0,0 +1,338 @@
+#include <utils/DetectionFile.hpp>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+
+namespace utils
+{
+    // Fields are copied in host order; a big-endian port needs byte swapping here
+    static_assert(std::endian::native == std::endian::little, "DetectionFile assumes a little-endian host");
+
+    namespace
+    {
+        using Format = DetectionFileFormat;
+
+        template <typename T>
+        void put(std::vector<std::uint8_t> &out, const T &value)
+        {
+            const auto offset = out.size();
+            out.resize(offset + sizeof(T));
+            std::memcpy(out.data() + offset, &value, sizeof(T));
+        }
+
+        template <typename T>
+        T get(const std::uint8_t *in, std::size_t offset)
+        {
+            T value;
+            std::memcpy(&value, in + offset, sizeof(T));
+            return value;
+        }
+
+        // Same text as `std::fixed << std::setprecision(6)`, without a stream
+        void appendFixed(std::string &out, double value)
+        {
+            char buffer[64];
+            const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 6);
+            out.append(buffer, result.ptr);
+        }
+
+        // Bounds-checked sequential reads over the footer
+        class Cursor
+        {
+        public:
+            Cursor(const std::uint8_t *data, std::size_t begin, std::size_t end) : data_(data), pos_(begin), end_(end) {}
+
+            template <typename T>
+            T read()
+            {
+                need(sizeof(T));
+                const T value = get<T>(data_, pos_);
+                pos_ += sizeof(T);
+                return value;
+            }
+
+            std::string readString(std::size_t length)
+            {
+                need(length);
+                std::string value(reinterpret_cast<const char *>(data_ + pos_), length);
+                pos_ += length;
+                return value;
+            }
+
+        private:
+            void need(std::size_t bytes) const
+            {
+                if (bytes > end_ - pos_)
+                {
+                    throw std::runtime_error("DetectionFile: footer is truncated");
+                }
+            }
+
+            const std::uint8_t *data_;
+            std::size_t pos_;
+            std::size_t end_;
+        };
+    } // namespace
+
+    void DetectionFileFormat::appendCsvRow(std::string &out, const Detection &detection)
+    {
+        char frame[16];
+        const auto result = std::to_chars(frame, frame + sizeof(frame), detection.frame);
+        out.append(frame, result.ptr);
+        out += ',';
+        appendFixed(out, detection.timestamp);
+        out += ',';
+        out += detection.transmitter;
+        out += ',';
+        appendFixed(out, detection.x);
+        out += ',';
+        appendFixed(out, detection.y);
+        out += ',';
+        appendFixed(out, detection.z);
+        out += '\n';
+    }
+
+    DetectionFileWriter::DetectionFileWriter(const std::string &path)
+        : file_(path, std::ios::binary | std::ios::trunc), path_(path)
+    {
+        if (!file_)
+        {
+            throw std::runtime_error("DetectionFile: cannot open " + path + " for writing");
+        }
+
+        for (const char c : Format::MAGIC)
+        {
+            put<char>(pending_, c);
+        }
+        put<std::uint16_t>(pending_, Format::VERSION);
+        put<std::uint16_t>(pending_, static_cast<std::uint16_t>(Format::HEADER_SIZE));
+        put<std::uint16_t>(pending_, static_cast<std::uint16_t>(Format::RECORD_SIZE));
+        put<std::uint16_t>(pending_, 0);
+    }
+
+    DetectionFileWriter::~DetectionFileWriter()
+    {
+        try
+        {
+            finish();
+        }
+        catch (const std::exception &)
+        {
+            // Destructors must not throw; the file is left without a trailer and will be rejected
+        }
+    }
+
+    std::uint16_t DetectionFileWriter::transmitterId(std::string_view name)
+    {
+        // A scene has a handful of transmitters and consecutive records usually share one
+        if (lastTransmitter_ < transmitters_.size() && transmitters_[lastTransmitter_] == name)
+        {
+            return static_cast<std::uint16_t>(lastTransmitter_);
+        }
+        for (std::size_t i = 0; i < transmitters_.size(); ++i)
+        {
+            if (transmitters_[i] == name)
+            {
+                lastTransmitter_ = i;
+                return static_cast<std::uint16_t>(i);
+            }
+        }
+        if (transmitters_.size() > std::numeric_limits<std::uint16_t>::max())
+        {
+            throw std::runtime_error("DetectionFile: too many transmitter names");
+        }
+        lastTransmitter_ = transmitters_.size();
+        transmitters_.emplace_back(name);
+        return static_cast<std::uint16_t>(lastTransmitter_);
+    }
+
+    void DetectionFileWriter::append(std::int32_t frame, double timestamp, std::string_view transmitter, float x, float y, float z)
+    {
+        if (finished_)
+        {
+            return;
+        }
+
+        if (runs_.empty() || runs_.back().frame != frame || runs_.back().timestamp != timestamp)
+        {
+            runs_.push_back({frame, timestamp, records_, 0});
+        }
+        runs_.back().count++;
+
+        put<std::int32_t>(pending_, frame);
+        put<std::uint16_t>(pending_, transmitterId(transmitter));
+        put<std::uint16_t>(pending_, 0);
+        put<float>(pending_, x);
+        put<float>(pending_, y);
+        put<float>(pending_, z);
+        records_++;
+    }
+
+    void DetectionFileWriter::writePending()
+    {
+        if (pending_.empty())
+        {
+            return;
+        }
+        file_.write(reinterpret_cast<const char *>(pending_.data()), static_cast<std::streamsize>(pending_.size()));
+        if (!file_)
+        {
+            throw std::runtime_error("DetectionFile: failed to write " + path_);
+        }
+        pending_.clear();
+    }
+
+    void DetectionFileWriter::flush()
+    {
+        writePending();
+        file_.flush();
+    }
+
+    void DetectionFileWriter::finish()
+    {
+        if (finished_)
+        {
+            return;
+        }
+        finished_ = true;
+
+        const std::uint64_t footerOffset = Format::HEADER_SIZE + records_ * Format::RECORD_SIZE;
+        put<std::uint32_t>(pending_, static_cast<std::uint32_t>(transmitters_.size()));
+        for (const auto &name : transmitters_)
+        {
+            const auto length = static_cast<std::uint16_t>(std::min<std::size_t>(name.size(), std::numeric_limits<std::uint16_t>::max()));
+            put<std::uint16_t>(pending_, length);
+            pending_.insert(pending_.end(), name.begin(), name.begin() + length);
+        }
+        put<std::uint64_t>(pending_, runs_.size());
+        for (const auto &run : runs_)
+        {
+            put<std::int32_t>(pending_, run.frame);
+            put<std::uint32_t>(pending_, 0);
+            put<double>(pending_, run.timestamp);
+            put<std::uint64_t>(pending_, run.first);
+            put<std::uint64_t>(pending_, run.count);
+        }
+        put<std::uint64_t>(pending_, footerOffset);
+        for (const char c : Format::END_MAGIC)
+        {
+            put<char>(pending_, c);
+        }
+
+        writePending();
+        file_.close();
+    }
+
+    DetectionFileReader::DetectionFileReader(const std::string &path)
+        : file_(path)
+    {
+        const std::uint8_t *data = file_.data();
+        const std::size_t size = file_.size();
+        if (size < Format::HEADER_SIZE + Format::TRAILER_SIZE || std::memcmp(data, Format::MAGIC, sizeof(Format::MAGIC)) != 0)
+        {
+            throw std::runtime_error("DetectionFile: not a detection export: " + path);
+        }
+        if (get<std::uint16_t>(data, 8) != Format::VERSION)
+        {
+            throw std::runtime_error("DetectionFile: unsupported format version " + std::to_string(get<std::uint16_t>(data, 8)));
+        }
+        const std::size_t headerSize = get<std::uint16_t>(data, 10);
+        const std::size_t recordSize = get<std::uint16_t>(data, 12);
+        if (headerSize < Format::HEADER_SIZE || recordSize != Format::RECORD_SIZE)
+        {
+            throw std::runtime_error("DetectionFile: unexpected header or record size in " + path);
+        }
+
+        const std::size_t trailer = size - Format::TRAILER_SIZE;
+        if (std::memcmp(data + trailer + 8, Format::END_MAGIC, sizeof(Format::END_MAGIC)) != 0)
+        {
+            throw std::runtime_error("DetectionFile: " + path + " was not finished (no trailer)");
+        }
+        const auto footerOffset = get<std::uint64_t>(data, trailer);
+        if (footerOffset < headerSize || footerOffset > trailer || (footerOffset - headerSize) % recordSize != 0)
+        {
+            throw std::runtime_error("DetectionFile: footer offset out of range in " + path);
+        }
+        recordCount_ = (footerOffset - headerSize) / recordSize;
+
+        Cursor footer(data, static_cast<std::size_t>(footerOffset), trailer);
+        const auto nameCount = footer.read<std::uint32_t>();
+        transmitters_.reserve(nameCount);
+        for (std::uint32_t i = 0; i < nameCount; ++i)
+        {
+            transmitters_.push_back(footer.readString(footer.read<std::uint16_t>()));
+        }
+
+        const auto runCount = footer.read<std::uint64_t>();
+        if (runCount > (trailer - footerOffset) / Format::FRAME_RUN_SIZE)
+        {
+            throw std::runtime_error("DetectionFile: frame index is truncated in " + path);
+        }
+        runs_.reserve(static_cast<std::size_t>(runCount));
+        for (std::uint64_t i = 0; i < runCount; ++i)
+        {
+            FrameRun run;
+            run.frame = footer.read<std::int32_t>();
+            footer.read<std::uint32_t>();
+            run.timestamp = footer.read<double>();
+            run.firstRecord = footer.read<std::uint64_t>();
+            run.recordCount = footer.read<std::uint64_t>();
+            if (run.firstRecord > recordCount_ || run.recordCount > recordCount_ - run.firstRecord)
+            {
+                throw std::runtime_error("DetectionFile: frame index points past the records in " + path);
+            }
+            runs_.push_back(run);
+        }
+    }
+
+    void DetectionFileReader::forEach(const std::function<void(const Detection &)> &visit,
+                                      std::int32_t firstFrame, std::int32_t lastFrame) const
+    {
+        const std::uint8_t *records = file_.data() + get<std::uint16_t>(file_.data(), 10);
+        static const std::string unknown = "?";
+
+        Detection detection;
+        for (const auto &run : runs_)
+        {
+            if (run.frame < firstFrame || run.frame > lastFrame)
+            {
+                continue;
+            }
+            detection.frame = run.frame;
+            detection.timestamp = run.timestamp;
+
+            const std::uint8_t *record = records + run.firstRecord * Format::RECORD_SIZE;
+            for (std::uint64_t i = 0; i < run.recordCount; ++i, record += Format::RECORD_SIZE)
+            {
+                const auto id = get<std::uint16_t>(record, 4);
+                detection.transmitter = id < transmitters_.size() ? transmitters_[id] : unknown;
+                detection.x = get<float>(record, 8);
+                detection.y = get<float>(record, 12);
+                detection.z = get<float>(record, 16);
+                visit(detection);
+            }
+        }
+    }
+
+    std::uint64_t DetectionFileReader::writeCsv(std::ostream &out, std::int32_t firstFrame, std::int32_t lastFrame) const
+    {
+        constexpr std::size_t chunkBytes = 64 * 1024;
+        std::string chunk = Format::CSV_HEADER;
+        std::uint64_t rows = 0;
+        forEach([&](const Detection &detection)
+                {
+                    Format::appendCsvRow(chunk, detection);
+                    ++rows;
+                    if (chunk.size() >= chunkBytes)
+                    {
+                        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+                        chunk.clear();
+                    } },
+                firstFrame, lastFrame);
+        out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        return rows;
+    }
+
+} // namespace utils
@@ -0,0 +1,110 @@
+#include <utils/MappedFile.hpp>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ADSIL_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace utils
+{
+    MappedFile::MappedFile(const std::string &path)
+        : path_(path)
+    {
+#ifdef ADSIL_HAS_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("MappedFile: cannot open " + path + ": " + std::strerror(errno));
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+
+        if (size_ > 0)
+        {
+            void *mapping = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (mapping == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("MappedFile: cannot map " + path + ": " + std::strerror(errno));
+            }
+            data_ = static_cast<const std::uint8_t *>(mapping);
+            mapped_ = true;
+        }
+        ::close(fd); // the mapping keeps its own reference to the file
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file)
+        {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+        size_ = static_cast<std::size_t>(file.tellg());
+        auto *copy = new std::uint8_t[size_ > 0 ? size_ : 1];
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(copy), static_cast<std::streamsize>(size_));
+        if (!file)
+        {
+            delete[] copy;
+            throw std::runtime_error("MappedFile: failed to read " + path);
+        }
+        data_ = copy;
+#endif
+    }
+
+    MappedFile::~MappedFile()
+    {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : path_(std::move(other.path_)),
+          data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)),
+          mapped_(std::exchange(other.mapped_, false))
+    {
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            path_ = std::move(other.path_);
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            mapped_ = std::exchange(other.mapped_, false);
+        }
+        return *this;
+    }
+
+    void MappedFile::release()
+    {
+        if (data_ == nullptr)
+        {
+            return;
+        }
+#ifdef ADSIL_HAS_MMAP
+        if (mapped_)
+        {
+            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+        }
+#else
+        delete[] data_;
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        mapped_ = false;
+    }
+}
@@ -0,0 +1,227 @@
+#include "utils/DataExporter.hpp"
+#include <csignal>
+#include <filesystem>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/resource.h>
+
+// Simple test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+namespace
+{
+    std::filesystem::path testDir()
+    {
+        return std::filesystem::temp_directory_path() / "data_exporter_test";
+    }
+
+    std::vector<std::string> readLines(const std::string &path)
+    {
+        std::vector<std::string> lines;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+}
+
+void test_rowFormat()
+{
+    std::cout << "\n=== Testing row format ===" << std::endl;
+
+    auto &exporter = utils::DataExporter::getInstance();
+    assert_true(exporter.init(testDir().string()), "Exporter initializes");
+    assert_true(exporter.startSession(), "Session starts");
+    assert_true(exporter.isActive(), "Exporter is active during a session");
+
+    exporter.setFrameContext(7, 1.25);
+    exporter.exportPoint("tx_front", 1.5f, -2.0f, 0.125f);
+    exporter.exportPoint(std::string(64, 'n'), 0.0f, 0.0f, 0.0f);
+    const auto path = exporter.getCurrentFilePath();
+    exporter.endSession();
+    assert_true(!exporter.isActive(), "Exporter is inactive after endSession");
+
+    const auto lines = readLines(path);
+    assert_true(lines.size() == 3, "Header plus one line per point");
+    assert_true(lines[0] == "frame,timestamp,transmitter,x,y,z", "Header is written");
+    assert_true(lines[1] == "7,1.250000,tx_front,1.500000,-2.000000,0.125000", "Row uses fixed six-digit precision");
+    assert_true(lines[2].find(',' + std::string(utils::DataExporter::MAX_TRANSMITTER_NAME, 'n') + ',') != std::string::npos,
+                "Long transmitter names are truncated");
+
+    exporter.exportPoint("tx_front", 0.0f, 0.0f, 0.0f);
+    assert_true(readLines(path).size() == 3, "Points after endSession are ignored");
+}
+
+void test_concurrentProducersLoseNothing()
+{
+    std::cout << "\n=== Testing concurrent producers ===" << std::endl;
+
+    constexpr int producers = 4;
+    constexpr int perProducer = 5000;
+
+    auto &exporter = utils::DataExporter::getInstance();
+    exporter.init(testDir().string());
+    exporter.startSession();
+    exporter.setFrameContext(3, 0.5);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&exporter, p]
+                             {
+            for (int i = 0; i < perProducer; ++i)
+            {
+                exporter.exportPoint("tx" + std::to_string(p), static_cast<float>(i), 0.0f, 0.0f);
+            } });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    const auto path = exporter.getCurrentFilePath();
+    exporter.endSession();
+
+    const auto stats = exporter.getStats();
+    const auto lines = readLines(path);
+    std::set<std::string> unique(lines.begin() + 1, lines.end());
+    assert_true(stats.dropped == 0, "Nothing is dropped with the default queue");
+    assert_true(stats.written == producers * perProducer, "Writer reports every row written");
+    assert_true(lines.size() == producers * perProducer + 1 && unique.size() == producers * perProducer,
+                "endSession writes out every queued row");
+    assert_true(stats.batches > 0 && stats.flushes > 0, "Rows are written in batches and flushed");
+}
+
+void test_fullQueueCountsDrops()
+{
+    std::cout << "\n=== Testing queue overflow ===" << std::endl;
+
+    auto &exporter = utils::DataExporter::getInstance();
+    exporter.init(testDir().string(), 4);
+    exporter.startSession();
+
+    // Faster than the writer drains, so the 4-slot queue overflows
+    constexpr int points = 10000;
+    for (int i = 0; i < points; ++i)
+    {
+        exporter.exportPoint("tx", 0.0f, 0.0f, 0.0f);
+    }
+    const auto path = exporter.getCurrentFilePath();
+    exporter.endSession();
+
+    const auto stats = exporter.getStats();
+    assert_true(stats.dropped > 0, "A full queue drops records instead of blocking");
+    assert_true(stats.failed == 0, "Drops of a full queue are not counted as write errors");
+    assert_true(stats.enqueued + stats.dropped == points, "Every point is either queued or counted as dropped");
+    assert_true(readLines(path).size() == stats.written + 1 && stats.written == stats.enqueued,
+                "Every queued record reaches the file");
+
+    exporter.init(testDir().string()); // restore the default capacity
+}
+
+void test_writeErrorsCountedApartFromDrops()
+{
+    std::cout << "\n=== Testing write errors ===" << std::endl;
+
+    auto &exporter = utils::DataExporter::getInstance();
+    exporter.init(testDir().string());
+    exporter.startSession();
+
+    // Files may not grow past 4 KB; with SIGXFSZ ignored, writes beyond it fail with EFBIG
+    rlimit previous{};
+    getrlimit(RLIMIT_FSIZE, &previous);
+    const auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+    rlimit limited = previous;
+    limited.rlim_cur = 4096;
+    setrlimit(RLIMIT_FSIZE, &limited);
+
+    constexpr int points = 5000; // well over 4 KB of CSV
+    for (int i = 0; i < points; ++i)
+    {
+        exporter.exportPoint("tx", static_cast<float>(i), 0.0f, 0.0f);
+    }
+    exporter.endSession();
+
+    setrlimit(RLIMIT_FSIZE, &previous);
+    std::signal(SIGXFSZ, previousHandler);
+
+    const auto stats = exporter.getStats();
+    assert_true(stats.failed > 0, "Rows that could not be written are counted as failed");
+    assert_true(stats.dropped == 0, "Write errors are not reported as a full queue");
+    assert_true(stats.written + stats.failed == stats.enqueued, "Every queued row is either written or failed");
+}
+
+void test_binaryFormatMatchesCsv()
+{
+    std::cout << "\n=== Testing binary export ===" << std::endl;
+
+    const auto exportFrames = [](utils::DataExporter::Format format)
+    {
+        auto &exporter = utils::DataExporter::getInstance();
+        exporter.init(testDir().string());
+        exporter.setFormat(format);
+        exporter.startSession();
+        for (int frame = 0; frame < 20; ++frame)
+        {
+            exporter.setFrameContext(frame, frame * 0.1);
+            for (int i = 0; i < 50; ++i)
+            {
+                exporter.exportPoint(i % 2 ? "tx_left" : "tx_right", static_cast<float>(i) * 0.5f, -1.0f, static_cast<float>(frame));
+            }
+        }
+        const auto path = exporter.getCurrentFilePath();
+        exporter.endSession();
+        exporter.setFormat(utils::DataExporter::Format::Csv);
+        return path;
+    };
+
+    const auto csvPath = exportFrames(utils::DataExporter::Format::Csv);
+    std::ifstream csvFile(csvPath);
+    const std::string csv((std::istreambuf_iterator<char>(csvFile)), std::istreambuf_iterator<char>());
+    std::filesystem::remove(csvPath); // the binary session may get the same timestamped name stem
+
+    const auto binaryPath = exportFrames(utils::DataExporter::Format::Binary);
+    assert_true(std::filesystem::path(binaryPath).extension() == utils::DetectionFileFormat::EXTENSION,
+                "Binary sessions write an .adsdet file");
+    assert_true(std::filesystem::file_size(binaryPath) * 2 < csv.size(), "Binary export is less than half the CSV size");
+
+    const utils::DetectionFileReader reader(binaryPath);
+    std::ostringstream converted;
+    reader.writeCsv(converted);
+    assert_true(reader.frameRuns().size() == 20, "Frame index has one run per exported frame");
+    assert_true(converted.str() == csv, "Binary export converts back to the identical CSV");
+}
+
+int main()
+{
+    std::cout << "📝 Starting DataExporter Tests" << std::endl;
+    std::cout << "==============================" << std::endl;
+
+    std::filesystem::remove_all(testDir());
+
+    test_rowFormat();
+    test_concurrentProducersLoseNothing();
+    test_fullQueueCountsDrops();
+    test_writeErrorsCountedApartFromDrops();
+    test_binaryFormatMatchesCsv();
+
+    std::filesystem::remove_all(testDir());
+
+    std::cout << "\n🎉 All DataExporter tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include "utils/DetectionFile.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Simple test assertion helper
+void assert_true(bool condition, const std::string &message)
+{
+    if (!condition)
+    {
+        std::cerr << "ASSERTION FAILED: " << message << std::endl;
+        exit(1);
+    }
+    std::cout << "✓ " << message << std::endl;
+}
+
+namespace
+{
+    std::string tempPath(const std::string &name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    // Three frames, two transmitters; frame 2 has no detections
+    void writeSample(const std::string &path)
+    {
+        utils::DetectionFileWriter writer(path);
+        writer.append(1, 0.1, "tx_front", 1.0f, 2.0f, 3.0f);
+        writer.append(1, 0.1, "tx_rear", -1.0f, 0.5f, 0.0f);
+        writer.writePending();
+        writer.append(3, 0.3, "tx_front", 4.0f, 5.0f, 6.0f);
+        writer.append(4, 0.4, "tx_rear", 7.0f, 8.0f, 9.25f);
+        writer.finish();
+    }
+}
+
+void test_roundTrip()
+{
+    std::cout << "\n=== Testing write/read round trip ===" << std::endl;
+
+    const auto path = tempPath("detections_roundtrip.adsdet");
+    writeSample(path);
+
+    constexpr auto fixedBytes = utils::DetectionFileFormat::HEADER_SIZE + utils::DetectionFileFormat::TRAILER_SIZE;
+    assert_true(std::filesystem::file_size(path) < fixedBytes + 4 * utils::DetectionFileFormat::RECORD_SIZE + 200,
+                "File holds fixed-width records plus a small footer");
+
+    const utils::DetectionFileReader reader(path);
+    assert_true(reader.recordCount() == 4, "Record count comes from the footer offset");
+    assert_true(reader.transmitters().size() == 2 && reader.transmitters()[1] == "tx_rear",
+                "Transmitter names are stored once in a table");
+    assert_true(reader.frameRuns().size() == 3 && reader.frameRuns()[0].recordCount == 2 &&
+                    reader.frameRuns()[2].firstRecord == 3,
+                "Frame index has one run per frame");
+
+    std::vector<utils::Detection> all;
+    std::vector<std::string> names;
+    reader.forEach([&](const utils::Detection &d)
+                   { all.push_back(d); names.emplace_back(d.transmitter); });
+    assert_true(all.size() == 4, "All records are visited");
+    assert_true(all[3].frame == 4 && all[3].timestamp == 0.4 && all[3].z == 9.25f && names[3] == "tx_rear",
+                "Fields survive the round trip");
+
+    std::filesystem::remove(path);
+}
+
+void test_frameFilterAndCsv()
+{
+    std::cout << "\n=== Testing frame filter and CSV conversion ===" << std::endl;
+
+    const auto path = tempPath("detections_csv.adsdet");
+    writeSample(path);
+    const utils::DetectionFileReader reader(path);
+
+    int visited = 0;
+    reader.forEach([&](const utils::Detection &)
+                   { ++visited; },
+                   2, 3);
+    assert_true(visited == 1, "Frame range selects only matching frames");
+
+    std::ostringstream csv;
+    const auto rows = reader.writeCsv(csv, 3, 4);
+    assert_true(rows == 2, "writeCsv reports the rows it wrote");
+    assert_true(csv.str() == "frame,timestamp,transmitter,x,y,z\n"
+                             "3,0.300000,tx_front,4.000000,5.000000,6.000000\n"
+                             "4,0.400000,tx_rear,7.000000,8.000000,9.250000\n",
+                "CSV matches the exporter's text format");
+
+    std::filesystem::remove(path);
+}
+
+void test_rejectsBadFiles()
+{
+    std::cout << "\n=== Testing invalid files ===" << std::endl;
+
+    const auto path = tempPath("detections_bad.adsdet");
+    const auto rejected = [&path]
+    {
+        try
+        {
+            utils::DetectionFileReader reader(path);
+            return false;
+        }
+        catch (const std::runtime_error &)
+        {
+            return true;
+        }
+    };
+
+    {
+        utils::DetectionFileWriter writer(path);
+        writer.append(1, 0.1, "tx", 0.0f, 0.0f, 0.0f);
+        writer.writePending(); // no finish(): simulates a crash mid-session
+        writer.flush();
+        const auto unfinished = [&path]
+        {
+            try
+            {
+                utils::DetectionFileReader reader(path);
+                return false;
+            }
+            catch (const std::runtime_error &)
+            {
+                return true;
+            }
+        }();
+        assert_true(unfinished, "A file without trailer is rejected");
+    }
+
+    writeSample(path);
+    const auto size = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, size - 5);
+    assert_true(rejected(), "A truncated file is rejected");
+
+    std::ofstream(path, std::ios::trunc) << "frame,timestamp,transmitter,x,y,z\n1,0.1,tx,0,0,0\n";
+    assert_true(rejected(), "A CSV file is rejected");
+
+    std::filesystem::remove(path);
+}
+
+int main()
+{
+    std::cout << "🗂️ Starting DetectionFile Tests" << std::endl;
+    std::cout << "===============================" << std::endl;
+
+    test_roundTrip();
+    test_frameFilterAndCsv();
+    test_rejectsBadFiles();
+
+    std::cout << "\n🎉 All DetectionFile tests passed!" << std::endl;
+    return 0;
+}
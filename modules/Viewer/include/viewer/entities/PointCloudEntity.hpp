@@ -11,11 +11,12 @@ namespace viewer
     class PointCloudEntity : public Entity
     {
     public:
-        PointCloudEntity(std::shared_ptr<math::PointCloud> cloud = nullptr, glm::vec3 color = glm::vec3(0.9F, 0.6F, 0.3F));
+        PointCloudEntity(std::shared_ptr<const math::PointCloud> cloud = nullptr, glm::vec3 color = glm::vec3(0.9F, 0.6F, 0.3F));
 
         void addPoints(std::vector<math::Point> points);
-        void setPointCloud(std::shared_ptr<math::PointCloud> cloud);
-        std::shared_ptr<math::PointCloud> getPointCloud() const;
+        // Shares the cloud with its producer (frame buffer, solver); it is never modified here
+        void setPointCloud(std::shared_ptr<const math::PointCloud> cloud);
+        std::shared_ptr<const math::PointCloud> getPointCloud() const;
 
         void setPointSize(float pointSize);
         void setColor(glm::vec3 color);
@@ -24,7 +25,7 @@ namespace viewer
         void setAlpha(float alpha);
 
     private:
-        std::shared_ptr<math::PointCloud> cloud_;
+        std::shared_ptr<const math::PointCloud> cloud_;
         glm::vec3 color_;
     };
 }
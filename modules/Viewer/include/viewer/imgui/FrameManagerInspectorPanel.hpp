@@ -16,7 +16,9 @@ namespace viewer::imgui
         void drawNavigationControls(const std::shared_ptr<simulation::FrameBufferManager> &frameBuffer);
         void drawPlaybackControls(const std::shared_ptr<simulation::FrameBufferManager> &frameBuffer);
         void drawJumpToFrame(const std::shared_ptr<simulation::FrameBufferManager> &frameBuffer);
+        void drawCacheStats(const std::shared_ptr<simulation::FrameBufferManager> &frameBuffer);
 
         int jumpTarget_ = 0;
+        double jumpTimestamp_ = 0.0;
     };
 }
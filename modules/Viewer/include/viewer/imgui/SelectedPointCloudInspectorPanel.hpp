@@ -14,10 +14,10 @@ namespace viewer::imgui
         void draw(const std::shared_ptr<viewer::PointCloudEntity> &selectedPointCloudEntity);
 
     private:
-        void drawPointCloudInfoSection(const std::shared_ptr<math::PointCloud> &pointCloud);
-        void drawPointCloudStatsSection(const std::shared_ptr<math::PointCloud> &pointCloud);
+        void drawPointCloudInfoSection(const std::shared_ptr<const math::PointCloud> &pointCloud);
+        void drawPointCloudStatsSection(const std::shared_ptr<const math::PointCloud> &pointCloud);
         void drawPointCloudVisualizationSection(const std::shared_ptr<viewer::PointCloudEntity> &pointCloudEntity);
-        void drawPointCloudDataSection(const std::shared_ptr<math::PointCloud> &pointCloud);
+        void drawPointCloudDataSection(const std::shared_ptr<const math::PointCloud> &pointCloud);
 
         // Visualization settings
         bool showPointCloudData_ = false;
@@ -41,7 +41,7 @@ namespace viewer::imgui
         mutable float boundingBoxMax_[3] = {0.0f, 0.0f, 0.0f};
         mutable float averageDistance_ = 0.0f;
 
-        void calculateStatistics(const std::shared_ptr<math::PointCloud> &pointCloud) const;
+        void calculateStatistics(const std::shared_ptr<const math::PointCloud> &pointCloud) const;
         bool isPointInFilter(const math::Point &point) const;
     };
 }
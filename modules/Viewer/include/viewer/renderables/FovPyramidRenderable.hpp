@@ -22,11 +22,13 @@ namespace viewer
         void cleanup() override;
 
     private:
-        void updateVertices();
+        void updateVertices(const DeviceFrustum &frustum);
 
         std::shared_ptr<Device> device_;
 
-        bool dirty_ = true; // flag to indicate if vertices need updating
+        // Frustum whose world-space corners are currently in the VBO; re-upload when the
+        // device hands out a different one (pose or FOV change)
+        std::shared_ptr<const DeviceFrustum> uploadedFrustum_;
 
     protected:
         void createShader() override;
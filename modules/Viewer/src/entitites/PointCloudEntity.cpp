@@ -3,7 +3,7 @@
 namespace viewer
 {
 
-    PointCloudEntity::PointCloudEntity(std::shared_ptr<math::PointCloud> cloud, glm::vec3 color)
+    PointCloudEntity::PointCloudEntity(std::shared_ptr<const math::PointCloud> cloud, glm::vec3 color)
         : cloud_(cloud ? cloud : std::make_shared<math::PointCloud>()), color_(color)
     {
         renderable_ = std::make_shared<PointCloudRenderable>(cloud_, color_);
@@ -11,18 +11,17 @@ namespace viewer
 
     void PointCloudEntity::addPoints(std::vector<math::Point> points)
     {
-        if (!cloud_)
-        {
-            cloud_ = std::make_shared<math::PointCloud>();
-        }
-        cloud_->addPoints(points);
+        // The current cloud may be shared; extend a copy and switch to it
+        auto extended = cloud_ ? std::make_shared<math::PointCloud>(*cloud_) : std::make_shared<math::PointCloud>();
+        extended->addPoints(points);
+        cloud_ = std::move(extended);
         if (renderable_)
         {
             std::dynamic_pointer_cast<PointCloudRenderable>(renderable_)->updatePointCloud(cloud_);
         }
     }
 
-    void PointCloudEntity::setPointCloud(std::shared_ptr<math::PointCloud> cloud)
+    void PointCloudEntity::setPointCloud(std::shared_ptr<const math::PointCloud> cloud)
     {
         cloud_ = cloud;
         if (renderable_)
@@ -31,7 +30,7 @@ namespace viewer
         }
     }
 
-    std::shared_ptr<math::PointCloud> PointCloudEntity::getPointCloud() const
+    std::shared_ptr<const math::PointCloud> PointCloudEntity::getPointCloud() const
     {
         return cloud_;
     }
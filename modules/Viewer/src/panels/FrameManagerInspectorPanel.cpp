@@ -15,6 +15,7 @@ namespace viewer::imgui
         drawNavigationControls(frameBuffer);
         drawPlaybackControls(frameBuffer); // <-- New
         drawJumpToFrame(frameBuffer);
+        drawCacheStats(frameBuffer);
 
         ImGui::End();
     }
@@ -75,6 +76,55 @@ namespace viewer::imgui
         {
             frameBuffer->seek(jumpTarget_);
         }
+
+        ImGui::InputDouble("Jump to Time (s)", &jumpTimestamp_, 0.0, 0.0, "%.4f");
+        if (ImGui::Button("Jump to Time"))
+        {
+            frameBuffer->seekToTimestamp(jumpTimestamp_);
+        }
+
+        if (frameBuffer->isSeeking())
+        {
+            ImGui::SameLine();
+            ImGui::Text("Loading frame %d...", frameBuffer->getPendingSeekTarget());
+        }
+
+        const auto seekStats = frameBuffer->getSeekStats();
+        if (seekStats.count > 0)
+        {
+            ImGui::Text("Seek latency: last %.1f ms, avg %.1f ms, max %.1f ms", seekStats.lastMs, seekStats.averageMs(),
+                        seekStats.maxMs);
+        }
+    }
+
+    void FrameManagerInspectorPanel::drawCacheStats(const std::shared_ptr<simulation::FrameBufferManager> &frameBuffer)
+    {
+        ImGui::Spacing();
+        if (!ImGui::CollapsingHeader("Frame Cache", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        const auto stats = frameBuffer->getCacheStats();
+        const auto lookups = stats.hits + stats.misses;
+        const float hitRate = lookups > 0 ? 100.0f * static_cast<float>(stats.hits) / static_cast<float>(lookups) : 0.0f;
+        constexpr float mb = 1024.0f * 1024.0f;
+
+        ImGui::Text("Frames: %zu (%.1f / %.1f MB)", stats.entries, static_cast<float>(stats.bytes) / mb,
+                    static_cast<float>(stats.budgetBytes) / mb);
+        ImGui::Text("Hits: %llu  Misses: %llu (%.1f%% hit rate)", static_cast<unsigned long long>(stats.hits),
+                    static_cast<unsigned long long>(stats.misses), hitRate);
+        ImGui::Text("Evictions: %llu", static_cast<unsigned long long>(stats.evictions));
+
+        const auto prefetch = frameBuffer->getPrefetchStats();
+        ImGui::Text("Prefetch queue: %zu (%zu loading on %zu threads)", prefetch.queueDepth, prefetch.inFlight,
+                    frameBuffer->getIoThreadCount());
+        ImGui::Text("Prefetched: %llu  Cancelled: %llu  Failed: %llu", static_cast<unsigned long long>(prefetch.completed),
+                    static_cast<unsigned long long>(prefetch.cancelled), static_cast<unsigned long long>(prefetch.failures));
+        ImGui::Text("Stalls: %llu", static_cast<unsigned long long>(prefetch.stalls));
+
+        const auto pool = frameBuffer->getPointPoolStats();
+        ImGui::Text("Point buffers: %zu pooled (%.1f MB)", pool.pooledBuffers, static_cast<float>(pool.pooledBytes) / mb);
+        ImGui::Text("Reused: %llu  Grown: %llu  Allocated: %llu", static_cast<unsigned long long>(pool.reused),
+                    static_cast<unsigned long long>(pool.grown), static_cast<unsigned long long>(pool.allocated));
     }
 
 }
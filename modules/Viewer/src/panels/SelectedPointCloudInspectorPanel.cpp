@@ -18,7 +18,7 @@ namespace viewer::imgui
             }
 
             // Invalidate stats cache when point cloud changes
-            static std::weak_ptr<math::PointCloud> lastCloud;
+            static std::weak_ptr<const math::PointCloud> lastCloud;
             if (lastCloud.lock() != currentCloud)
             {
                 statsValid_ = false;
@@ -39,7 +39,7 @@ namespace viewer::imgui
         ImGui::End();
     }
 
-    void SelectedPointCloudInspectorPanel::drawPointCloudInfoSection(const std::shared_ptr<math::PointCloud> &pointCloud)
+    void SelectedPointCloudInspectorPanel::drawPointCloudInfoSection(const std::shared_ptr<const math::PointCloud> &pointCloud)
     {
         if (ImGui::CollapsingHeader("Point Cloud Information", ImGuiTreeNodeFlags_DefaultOpen))
         {
@@ -66,7 +66,7 @@ namespace viewer::imgui
         }
     }
 
-    void SelectedPointCloudInspectorPanel::drawPointCloudStatsSection(const std::shared_ptr<math::PointCloud> &pointCloud)
+    void SelectedPointCloudInspectorPanel::drawPointCloudStatsSection(const std::shared_ptr<const math::PointCloud> &pointCloud)
     {
         if (ImGui::CollapsingHeader("Point Cloud Statistics", ImGuiTreeNodeFlags_DefaultOpen))
         {
@@ -141,7 +141,7 @@ namespace viewer::imgui
         }
     }
 
-    void SelectedPointCloudInspectorPanel::drawPointCloudDataSection(const std::shared_ptr<math::PointCloud> &pointCloud)
+    void SelectedPointCloudInspectorPanel::drawPointCloudDataSection(const std::shared_ptr<const math::PointCloud> &pointCloud)
     {
         if (ImGui::CollapsingHeader("Raw Point Data", ImGuiTreeNodeFlags_None))
         {
@@ -213,7 +213,7 @@ namespace viewer::imgui
         }
     }
 
-    void SelectedPointCloudInspectorPanel::calculateStatistics(const std::shared_ptr<math::PointCloud> &pointCloud) const
+    void SelectedPointCloudInspectorPanel::calculateStatistics(const std::shared_ptr<const math::PointCloud> &pointCloud) const
     {
         if (!pointCloud || pointCloud->empty())
             return;
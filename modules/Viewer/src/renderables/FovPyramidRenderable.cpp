@@ -51,25 +51,21 @@ namespace viewer
         glEnableVertexAttribArray(0);
 
         gl::VertexArray::unbind();
+        uploadedFrustum_.reset();
     }
 
-    void FoVPyramidRenderable::updateVertices()
+    void FoVPyramidRenderable::updateVertices(const DeviceFrustum &frustum)
     {
         if (!vbo_)
             return;
 
-        float fovH = device_->getHorizontalFovRad();
-        float fovV = device_->getVerticalFovRad();
-        float range = device_->getRange();
-
-        float halfW = range * tanf(fovH / 2.0F);
-        float halfH = range * tanf(fovV / 2.0F);
-
-        glm::vec3 apex(0.0F, 0.0F, 0.0F);
-        glm::vec3 v1(range, -halfW, halfH);
-        glm::vec3 v2(range, halfW, halfH);
-        glm::vec3 v3(range, halfW, -halfH);
-        glm::vec3 v4(range, -halfW, -halfH);
+        // Vertices are in world space, taken straight from the device's cached frustum
+        const auto &corners = frustum.getCorners();
+        glm::vec3 apex = frustum.getOrigin().toGlmVec3();
+        glm::vec3 v1 = corners[0].toGlmVec3();
+        glm::vec3 v2 = corners[1].toGlmVec3();
+        glm::vec3 v3 = corners[2].toGlmVec3();
+        glm::vec3 v4 = corners[3].toGlmVec3();
 
         std::vector<glm::vec3> triangleVertices = {
             apex, v1, v2, // front face
@@ -95,13 +91,15 @@ namespace viewer
         if (!device_ || !shader_ || !vao_)
             return;
 
-        // if (dirty_)
+        auto frustum = device_->getFrustum();
+        if (frustum != uploadedFrustum_)
         {
-            updateVertices();
-            dirty_ = false;
+            updateVertices(*frustum);
+            uploadedFrustum_ = std::move(frustum);
         }
 
-        glm::mat4 model = device_->getGlobalTransform().getModelMatrix();
+        // Frustum corners are already in world space
+        glm::mat4 model(1.0F);
 
         vao_->bind();
         shader_->use();
@@ -141,6 +139,7 @@ namespace viewer
         vbo_.reset();
         vao_.reset();
         shader_.reset();
+        uploadedFrustum_.reset();
     }
     glm::vec3 FoVPyramidRenderable::getCenter() const
     {
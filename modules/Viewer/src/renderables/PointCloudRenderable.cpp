@@ -1,11 +1,15 @@
 #include <viewer/renderables/PointCloudRenderable.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <type_traits>
 
 namespace viewer
 {
+    // Points are uploaded straight from the cloud's storage as packed xyz floats
+    static_assert(std::is_standard_layout_v<math::Point> && sizeof(math::Point) == 3 * sizeof(float),
+                  "math::Point must be three packed floats to be used as vertex data");
 
-    PointCloudRenderable::PointCloudRenderable(std::shared_ptr<math::PointCloud> pointCloud, glm::vec3 color)
+    PointCloudRenderable::PointCloudRenderable(std::shared_ptr<const math::PointCloud> pointCloud, glm::vec3 color)
         : pointCloud_(std::move(pointCloud))
     {
         this->setColor(color);
@@ -57,15 +61,8 @@ namespace viewer
         // If we have data, populate the buffer
         if (pointCloud_ && !pointCloud_->empty())
         {
-            vertices_.clear();
-            vertices_.reserve(pointCloud_->size() * 3);
-            for (const auto &pt : pointCloud_->getPoints())
-            {
-                vertices_.push_back(pt.x());
-                vertices_.push_back(pt.y());
-                vertices_.push_back(pt.z());
-            }
-            glBufferData(GL_ARRAY_BUFFER, vertices_.size() * sizeof(float), vertices_.data(), GL_DYNAMIC_DRAW);
+            const auto &points = pointCloud_->getPoints();
+            glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(math::Point), points.data(), GL_DYNAMIC_DRAW);
         }
         else
         {
@@ -83,28 +80,21 @@ namespace viewer
             return;
         }
 
-        // Rebuild vertex array in CPU memory
-        vertices_.clear();
-        vertices_.reserve(pointCloud_->size() * 3);
-        for (const auto &pt : pointCloud_->getPoints())
-        {
-            vertices_.push_back(pt.x());
-            vertices_.push_back(pt.y());
-            vertices_.push_back(pt.z());
-        }
+        // No CPU-side staging copy: the shared cloud is immutable, upload it as it is
+        const auto &points = pointCloud_->getPoints();
 
         vbo_->bind(GL_ARRAY_BUFFER);
         // If capacity changed, reallocate; else use sub-data for speed
-        GLsizei newSize = static_cast<GLsizei>(vertices_.size() * sizeof(float));
+        GLsizei newSize = static_cast<GLsizei>(points.size() * sizeof(math::Point));
         GLint currentSize = 0;
         glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &currentSize);
         if (currentSize != newSize)
         {
-            glBufferData(GL_ARRAY_BUFFER, newSize, vertices_.data(), GL_DYNAMIC_DRAW);
+            glBufferData(GL_ARRAY_BUFFER, newSize, points.data(), GL_DYNAMIC_DRAW);
         }
         else if (newSize > 0)
         {
-            glBufferSubData(GL_ARRAY_BUFFER, 0, newSize, vertices_.data());
+            glBufferSubData(GL_ARRAY_BUFFER, 0, newSize, points.data());
         }
         gl::Buffer::unbind(GL_ARRAY_BUFFER);
 
@@ -149,7 +139,7 @@ namespace viewer
         return center;
     }
 
-    void PointCloudRenderable::updatePointCloud(std::shared_ptr<math::PointCloud> newCloud)
+    void PointCloudRenderable::updatePointCloud(std::shared_ptr<const math::PointCloud> newCloud)
     {
         pointCloud_ = std::move(newCloud);
         dirty_ = true;